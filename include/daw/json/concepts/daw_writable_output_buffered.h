@@ -0,0 +1,131 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include <daw/json/impl/version.h>
+
+#include "daw_writable_output_fwd.h"
+#include <daw/json/impl/daw_json_assert.h>
+
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/***
+		 * A writable output that collects the small pieces the serializer
+		 * writes into a fixed size buffer held in the object, and passes them to
+		 * Sink in blocks of BufferSize bytes.  Pieces larger than the buffer
+		 * are passed on directly.
+		 *
+		 * The remaining bytes are written by flush( ) or the destructor.  Errors
+		 * from the sink are reported by flush( ) and the writes as
+		 * ErrorReason::OutputError, but are ignored in the destructor, along
+		 * with anything the sink throws there, so call flush( ) to see them.
+		 * As to_json returns a copy of an rvalue output, pass this as an
+		 * lvalue.
+		 * @tparam Sink A type with a bool write_block( char const *, std::size_t )
+		 * member that returns false on error
+		 * @tparam BufferSize The number of bytes collected before a write
+		 */
+		template<typename Sink, std::size_t BufferSize = 16384U>
+		class basic_buffered_output {
+			static_assert( BufferSize > 0, "The buffer cannot be empty" );
+
+			Sink m_sink;
+			std::size_t m_size = 0;
+			char m_buffer[BufferSize];
+
+		public:
+			explicit basic_buffered_output( Sink sink )
+			  : m_sink( sink ) {}
+
+			basic_buffered_output( basic_buffered_output const & ) = delete;
+			basic_buffered_output &
+			operator=( basic_buffered_output const & ) = delete;
+
+			~basic_buffered_output( ) {
+				if( m_size == 0 ) {
+					return;
+				}
+#if defined( DAW_USE_EXCEPTIONS )
+				// A sink can throw, e.g. an ostream with exceptions enabled
+				try {
+#endif
+					(void)m_sink.write_block( m_buffer, m_size );
+#if defined( DAW_USE_EXCEPTIONS )
+				} catch( ... ) {}
+#endif
+			}
+
+			/// @brief Pass the buffered bytes to the sink
+			void flush( ) {
+				if( m_size == 0 ) {
+					return;
+				}
+				std::size_t const size = m_size;
+				m_size = 0;
+				daw_json_ensure( m_sink.write_block( m_buffer, size ),
+				                 ErrorReason::OutputError );
+			}
+
+			void write( daw::string_view sv ) {
+				if( sv.size( ) > BufferSize - m_size ) {
+					flush( );
+					if( sv.size( ) >= BufferSize ) {
+						daw_json_ensure( m_sink.write_block( sv.data( ), sv.size( ) ),
+						                 ErrorReason::OutputError );
+						return;
+					}
+				}
+				std::memcpy( m_buffer + m_size, sv.data( ), sv.size( ) );
+				m_size += sv.size( );
+			}
+
+			void put( char c ) {
+				if( m_size == BufferSize ) {
+					flush( );
+				}
+				m_buffer[m_size++] = c;
+			}
+
+			/// @return The number of bytes waiting for flush
+			[[nodiscard]] std::size_t buffered_size( ) const {
+				return m_size;
+			}
+
+			[[nodiscard]] Sink const &sink( ) const {
+				return m_sink;
+			}
+		};
+
+		namespace concepts {
+			/// @brief Specialization for buffered outputs
+			template<typename Sink, std::size_t BufferSize>
+			struct writable_output_trait<basic_buffered_output<Sink, BufferSize>>
+			  : std::true_type {
+
+				template<typename... StringViews>
+				static inline void write( basic_buffered_output<Sink, BufferSize> &out,
+				                          StringViews const &...svs ) {
+					static_assert( sizeof...( StringViews ) > 0 );
+					(void)( ( out.write( daw::string_view( svs ) ), 0 ) | ... );
+				}
+
+				static inline void put( basic_buffered_output<Sink, BufferSize> &out,
+				                        char c ) {
+					out.put( c );
+				}
+			};
+		} // namespace concepts
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -10,6 +10,7 @@
 
 #include <daw/json/impl/version.h>
 
+#include "daw_writable_output_buffered.h"
 #include "daw_writable_output_fwd.h"
 #include <daw/json/impl/daw_json_assert.h>
 
@@ -17,8 +18,18 @@
 #include <daw/daw_character_traits.h>
 #include <daw/daw_string_view.h>
 
+#include <cstddef>
 #include <cstdio>
 
+// fwrite without taking the FILE lock, where the C library has one.  glibc
+// declares it with the default or BSD feature test macros
+#if defined( __GLIBC__ ) and \
+  ( defined( _DEFAULT_SOURCE ) or defined( _BSD_SOURCE ) )
+#define DAW_JSON_FWRITE_UNLOCKED fwrite_unlocked
+#elif defined( _MSC_VER )
+#define DAW_JSON_FWRITE_UNLOCKED _fwrite_nolock
+#endif
+
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
 		namespace concepts {
@@ -48,5 +59,36 @@ namespace daw::json {
 				}
 			};
 		} // namespace concepts
+
+		/// @brief A sink for basic_buffered_output that writes to a FILE *
+		/// @tparam Unlocked Skip the FILE lock, where the C library allows it.
+		/// Only for streams that no other thread writes to
+		template<bool Unlocked>
+		struct basic_file_sink {
+			std::FILE *file;
+
+			// Implicit so that a FILE * can construct a basic_buffered_output
+			basic_file_sink( std::FILE *f )
+			  : file( f ) {}
+
+			[[nodiscard]] bool write_block( char const *data,
+			                                std::size_t size ) const {
+				if constexpr( Unlocked ) {
+#if defined( DAW_JSON_FWRITE_UNLOCKED )
+					return DAW_JSON_FWRITE_UNLOCKED( data, 1, size, file ) == size;
+#endif
+				}
+				return std::fwrite( data, 1, size, file ) == size;
+			}
+		};
+
+		/// @brief Buffer the output to a FILE *, writing it in large blocks
+		using buffered_file_output = basic_buffered_output<basic_file_sink<false>>;
+
+		/// @brief Buffer the output to a FILE *, writing it without the FILE lock
+		/// where the C library allows it.  Only for streams that no other thread
+		/// writes to
+		using unlocked_buffered_file_output =
+		  basic_buffered_output<basic_file_sink<true>>;
 	} // namespace DAW_JSON_VER
 } // namespace daw::json
\ No newline at end of file
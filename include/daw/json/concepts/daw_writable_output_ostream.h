@@ -10,12 +10,14 @@
 
 #include <daw/json/impl/version.h>
 
+#include "daw_writable_output_buffered.h"
 #include "daw_writable_output_fwd.h"
 #include <daw/json/impl/daw_json_assert.h>
 
 #include <daw/daw_algorithm.h>
 #include <daw/daw_character_traits.h>
 
+#include <cstddef>
 #include <iostream>
 
 namespace daw::json {
@@ -51,5 +53,23 @@ namespace daw::json {
 				}
 			};
 		} // namespace concepts
+
+		/// @brief A sink for basic_buffered_output that writes to an ostream
+		struct ostream_sink {
+			std::ostream *os;
+
+			// Implicit so that an ostream can construct a basic_buffered_output
+			ostream_sink( std::ostream &o )
+			  : os( &o ) {}
+
+			[[nodiscard]] bool write_block( char const *data,
+			                                std::size_t size ) const {
+				os->write( data, static_cast<std::streamsize>( size ) );
+				return static_cast<bool>( *os );
+			}
+		};
+
+		/// @brief Buffer the output to an ostream, writing it in large blocks
+		using buffered_ostream_output = basic_buffered_output<ostream_sink>;
 	} // namespace DAW_JSON_VER
 } // namespace daw::json
@@ -24,7 +24,6 @@
 
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
-
 		/// @brief Construct the JSONMember from the JSON document argument.
 		/// @tparam JsonMember any bool, arithmetic, string, string_view,
 		/// daw::json::json_data_contract
@@ -50,8 +49,9 @@ namespace daw::json {
 			  "Missing specialization of daw::json::json_data_contract for class "
 			  "mapping or specialization of daw::json::json_link_basic_type_map" );
 			using json_member = json_details::json_deduced_type<JsonMember>;
-			using ParsePolicy =
-			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
+			using ParsePolicy = json_details::insitu_document_policy_t<
+			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>,
+			  String>;
 
 			/// If the string is known to have a trailing zero, allow optimization on
 			/// that
@@ -67,6 +67,9 @@ namespace daw::json {
 				--last;
 			}
 			auto parse_state = ParseState( first, last );
+			auto const structural_index =
+			  json_details::make_structural_index<ParseState>( first, last );
+			parse_state.set_structural_index( structural_index );
 
 			if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
 				auto result =
@@ -132,8 +135,9 @@ namespace daw::json {
 			char const *l = daw::data_end( json_data );
 			Allocator a = alloc;
 
-			using ParsePolicy =
-			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
+			using ParsePolicy = json_details::insitu_document_policy_t<
+			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>,
+			  String>;
 
 			/// @brief If the string is known to have a trailing zero, allow
 			/// optimization on that
@@ -141,6 +145,9 @@ namespace daw::json {
 			  ParsePolicy, String, options::ZeroTerminatedString::yes>;
 
 			auto parse_state = ParseState::with_allocator( f, l, a );
+			auto const structural_index =
+			  json_details::make_structural_index<ParseState>( f, l );
+			parse_state.set_structural_index( structural_index );
 			if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
 				auto result =
 				  json_details::parse_value<json_member, KnownBounds,
@@ -207,8 +214,9 @@ namespace daw::json {
 			  "Missing specialization of daw::json::json_data_contract for class "
 			  "mapping or specialization of daw::json::json_link_basic_type_map" );
 
-			using ParsePolicy =
-			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
+			using ParsePolicy = json_details::insitu_document_policy_t<
+			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>,
+			  String>;
 
 			/// @brief If the string is known to have a trailing zero, allow
 			/// optimization on that
@@ -271,6 +279,83 @@ namespace daw::json {
 			  DAW_FWD( json_data ), member_path, options::parse_flags<> );
 		}
 
+		/// @brief Parse a JSONMember from the json_data at a json_path or
+		/// json_pointer.  The path is parsed at compile time, so only the member
+		/// name hashes and array indices are compared while searching
+		/// @tparam JsonMember The type of the item being parsed
+		/// @param json_data JSON string data
+		/// @param path e.g. json_path<"a.b[3].c">{ } or
+		/// json_pointer<"/a/b/3/c">{ }
+		/// @tparam KnownBounds The bounds of the json_data are known to contain the
+		/// whole value
+		/// @return A value reified from the JSON data member
+		/// @throws daw::json::json_exception
+		template<typename JsonMember, bool KnownBounds = false, typename String,
+		         typename Path DAW_JSON_ENABLEIF(
+		           json_details::is_json_path_literal_v<Path> ),
+		         auto... PolicyFlags>
+		DAW_JSON_REQUIRES( json_details::is_json_path_literal_v<Path> )
+		[[nodiscard]] constexpr auto
+		from_json( String &&json_data, Path path,
+		           options::parse_flags_t<PolicyFlags...> =
+		             options::parse_flags<> ) {
+			static_assert(
+			  json_details::is_string_view_like_v<String>,
+			  "String type must have a be a contiguous range of Characters" );
+
+			daw_json_ensure( std::size( json_data ) != 0,
+			                 ErrorReason::EmptyJSONDocument );
+			daw_json_ensure( std::data( json_data ) != nullptr,
+			                 ErrorReason::EmptyJSONPath );
+
+			using json_member = json_details::json_deduced_type<JsonMember>;
+			static_assert(
+			  json_details::has_unnamed_default_type_mapping_v<JsonMember>,
+			  "Missing specialization of daw::json::json_data_contract for class "
+			  "mapping or specialization of daw::json::json_link_basic_type_map" );
+
+			using ParsePolicy = json_details::insitu_document_policy_t<
+			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>,
+			  String>;
+
+			using policy_zstring_t = json_details::apply_zstring_policy_option_t<
+			  ParsePolicy, String, options::ZeroTerminatedString::yes>;
+
+			using ParseState =
+			  daw::conditional_t<policy_zstring_t::is_default_parse_policy,
+			                     DefaultParsePolicy, policy_zstring_t>;
+			auto first = std::data( json_data );
+			auto last = daw::data_end( json_data );
+			if( first != last and last[-1] == 0 ) {
+				--last;
+			}
+			auto const jv = basic_json_value( ParseState( first, last ) )
+			                  .find_member( path );
+
+			if constexpr( json_details::is_json_nullable_v<json_member> ) {
+				if( not jv ) {
+					return json_details::construct_nullable_empty<
+					  json_details::json_constructor_t<json_member>>( );
+				}
+			} else {
+				daw_json_ensure( jv, ErrorReason::JSONPathNotFound );
+			}
+			auto parse_state = jv.get_raw_state( );
+			if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
+				auto result =
+				  json_details::parse_value<json_member, KnownBounds,
+				                            json_member::expected_type>( parse_state );
+				parse_state.trim_left( );
+				daw_json_ensure( parse_state.empty( ), ErrorReason::InvalidEndOfValue,
+				                 parse_state );
+				return result;
+			} else {
+				return json_details::parse_value<json_member, KnownBounds,
+				                                 json_member::expected_type>(
+				  parse_state );
+			}
+		}
+
 		/// @brief Parse a JSON Member from the json_data starting at member_path.
 		/// @tparam JsonMember The type of the item being parsed
 		/// @param json_data JSON string data
@@ -304,8 +389,9 @@ namespace daw::json {
 			  "Missing specialization of daw::json::json_data_contract for class "
 			  "mapping or specialization of daw::json::json_link_basic_type_map" );
 
-			using ParsePolicy =
-			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
+			using ParsePolicy = json_details::insitu_document_policy_t<
+			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>,
+			  String>;
 
 			/// @brief If the string is known to have a trailing zero, allow
 			/// optimization on that
@@ -517,8 +603,9 @@ namespace daw::json {
 			using parser_t =
 			  json_base::json_array<JsonElement, Container, Constructor>;
 
-			using ParsePolicy =
-			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
+			using ParsePolicy = json_details::insitu_document_policy_t<
+			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>,
+			  String>;
 
 			/// @brief If the string is known to have a trailing zero, allow
 			/// optimization on that
@@ -530,6 +617,10 @@ namespace daw::json {
 			                     DefaultParsePolicy, policy_zstring_t>;
 			auto parse_state =
 			  ParseState{ std::data( json_data ), daw::data_end( json_data ) };
+			auto const structural_index =
+			  json_details::make_structural_index<ParseState>( parse_state.first,
+			                                                   parse_state.last );
+			parse_state.set_structural_index( structural_index );
 
 			parse_state.trim_left_unchecked( );
 #if defined( DAW_JSON_BUGFIX_FROM_JSON_001 )
@@ -611,8 +702,9 @@ namespace daw::json {
 			using parser_t =
 			  json_base::json_array<JsonElement, Container, Constructor>;
 
-			using ParsePolicy =
-			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
+			using ParsePolicy = json_details::insitu_document_policy_t<
+			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>,
+			  String>;
 
 			/// @brief If the string is known to have a trailing zero, allow
 			/// optimization on that
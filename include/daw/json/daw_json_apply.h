@@ -119,6 +119,62 @@ namespace daw::json {
 			  DAW_FWD( callable ), DAW_FWD( json_doc ), json_path, flags );
 		}
 
+		/// @brief Parse to parameters specified in signature and pass them to
+		/// Callable for evaluation.  This is similar to std::apply but using JSON
+		/// documents instead of tuples.
+		/// @tparam Signature  The signature of the Callable.  Will try to auto
+		/// deduce if not specified.  Does not work when there are overloads(e.g.
+		/// auto params/template params/overloaded call operator or functions)
+		/// @tparam String Type of json document
+		/// @tparam Path A json_path or json_pointer parsed at compile time
+		/// @tparam Callable A callable to pass the parsed json document to
+		/// @param json_doc The json document with serialized data to parse
+		/// @param path The path to the element in the document to parse
+		/// @param callable The callable used to evaluate the parsed values.
+		/// @return The result of calling Callable
+		template<typename Signature = use_default, typename String,
+		         typename Path,
+		         typename Callable DAW_JSON_ENABLEIF(
+		           json_details::is_json_path_literal_v<Path> and
+		           json_details::has_call_operator<Callable> )>
+		DAW_JSON_REQUIRES( json_details::is_json_path_literal_v<Path> and
+		                   json_details::has_call_operator<Callable> )
+		constexpr auto json_apply( String &&json_doc, Path path,
+		                           Callable &&callable ) {
+			return json_details::json_apply_impl<Signature>(
+			  DAW_FWD( callable ), DAW_FWD( json_doc ), path );
+		}
+
+		/// @brief Parse to parameters specified in signature and pass them to
+		/// Callable for evaluation.  This is similar to std::apply but using JSON
+		/// documents instead of tuples.
+		/// @tparam Signature  The signature of the Callable.  Will try to auto
+		/// deduce if not specified.  Does not work when there are overloads(e.g.
+		/// auto params/template params/overloaded call operator or functions)
+		/// @tparam String Type of json document
+		/// @tparam Path A json_path or json_pointer parsed at compile time
+		/// @tparam Callable A callable to pass the parsed json document to
+		/// @tparam PolicyFlags Parser Policy flags.  See parser_policies.md
+		/// @param json_doc The json document with serialized data to parse
+		/// @param path The path to the element in the document to parse
+		/// @param flags Parsing policy flags to change parser behaviour
+		/// @param callable The callable used to evaluate the parsed values.
+		/// @return The result of calling Callable
+		template<typename Signature = use_default, typename String,
+		         typename Path, auto... PolicyFlags,
+		         typename Callable DAW_JSON_ENABLEIF(
+		           json_details::is_json_path_literal_v<Path> and
+		           json_details::has_call_operator<Callable> )>
+		DAW_JSON_REQUIRES( json_details::is_json_path_literal_v<Path> and
+		                   json_details::has_call_operator<Callable> )
+		constexpr auto json_apply(
+		  String &&json_doc, Path path,
+		  daw::json::options::parse_flags_t<PolicyFlags...> flags,
+		  Callable &&callable ) {
+			return json_details::json_apply_impl<Signature>(
+			  DAW_FWD( callable ), DAW_FWD( json_doc ), path, flags );
+		}
+
 		/// @brief Parse to parameters specified in signature and pass them to
 		/// Callable for evaluation.  This is similar to std::apply but using JSON
 		/// documents instead of tuples.
@@ -0,0 +1,136 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_from_json.h"
+
+#include <cstddef>
+
+#if __has_include( <memory_resource> )
+#include <memory_resource>
+#endif
+
+#if defined( __cpp_lib_memory_resource )
+#define DAW_JSON_HAS_ARENA
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/***
+		 * A bump allocator for the values allocated while parsing.  Memory is
+		 * handed out from blocks that grow geometrically and is only returned
+		 * by release( ) or when the arena is destroyed, so the many small
+		 * strings and vectors of a document cost a pointer bump each.
+		 *
+		 * Parse into std::pmr types with from_json_arena, or pass
+		 * get_allocator( ) to from_json_alloc.  Only values whose types take
+		 * the allocator use the arena, there is no parse option that sends
+		 * other allocations to it.  The parsed values must not outlive the
+		 * arena.
+		 */
+		class json_arena final : public std::pmr::memory_resource {
+			std::pmr::monotonic_buffer_resource m_resource;
+			std::size_t m_allocation_count = 0;
+			std::size_t m_bytes_allocated = 0;
+
+		public:
+			/// @brief An arena that takes its blocks from upstream
+			explicit json_arena( std::pmr::memory_resource *upstream =
+			                       std::pmr::get_default_resource( ) )
+			  : m_resource( upstream ) {}
+
+			/// @param initial_size The size of the first block
+			explicit json_arena( std::size_t initial_size,
+			                     std::pmr::memory_resource *upstream =
+			                       std::pmr::get_default_resource( ) )
+			  : m_resource( initial_size, upstream ) {}
+
+			/// @brief An arena that uses buffer first, and only takes blocks from
+			/// upstream when it is full.  The buffer must outlive the arena
+			json_arena( void *buffer, std::size_t buffer_size,
+			            std::pmr::memory_resource *upstream =
+			              std::pmr::get_default_resource( ) )
+			  : m_resource( buffer, buffer_size, upstream ) {}
+
+			// The parsed values point back at the arena
+			json_arena( json_arena const & ) = delete;
+			json_arena &operator=( json_arena const & ) = delete;
+
+			/// @return An allocator for from_json_alloc and the std::pmr types
+			[[nodiscard]] std::pmr::polymorphic_allocator<char> get_allocator( ) {
+				return std::pmr::polymorphic_allocator<char>( this );
+			}
+
+			/// @return The number of allocations made since the last release
+			[[nodiscard]] std::size_t allocation_count( ) const {
+				return m_allocation_count;
+			}
+
+			/// @return The number of bytes allocated since the last release
+			[[nodiscard]] std::size_t bytes_allocated( ) const {
+				return m_bytes_allocated;
+			}
+
+			/// @brief Free all of the memory allocated from the arena.  Values
+			/// parsed into it must not be used afterwards
+			void release( ) {
+				m_resource.release( );
+				m_allocation_count = 0;
+				m_bytes_allocated = 0;
+			}
+
+		private:
+			void *do_allocate( std::size_t bytes, std::size_t alignment ) override {
+				++m_allocation_count;
+				m_bytes_allocated += bytes;
+				return m_resource.allocate( bytes, alignment );
+			}
+
+			// Memory is only returned by release
+			void do_deallocate( void *, std::size_t, std::size_t ) override {}
+
+			[[nodiscard]] bool
+			do_is_equal( std::pmr::memory_resource const &other ) const noexcept
+			  override {
+				return this == &other;
+			}
+		};
+
+		/***
+		 * Construct the JSONMember from the JSON document, allocating every
+		 * string, container, and class member that takes an allocator from
+		 * arena.  Use the std::pmr types, or others whose allocator is
+		 * constructible from std::pmr::polymorphic_allocator, in the mapped
+		 * classes.
+		 *
+		 * This is from_json_alloc with arena.get_allocator( ).  Members whose
+		 * types do not take an allocator, like std::string, still use the
+		 * global allocator.
+		 * @tparam JsonMember any bool, arithmetic, string, string_view,
+		 * daw::json::json_data_contract
+		 * @param json_data JSON string data
+		 * @param arena The arena to allocate from.  It must outlive the result
+		 * @tparam KnownBounds The bounds of the json_data are known to contain
+		 * the whole value
+		 * @return A reified T constructed from JSON data
+		 * @throws daw::json::json_exception
+		 */
+		template<typename JsonMember, bool KnownBounds = false, typename String,
+		         auto... PolicyFlags>
+		[[nodiscard]] auto
+		from_json_arena( String &&json_data, json_arena &arena,
+		                 options::parse_flags_t<PolicyFlags...> flags =
+		                   options::parse_flags<> ) {
+			return from_json_alloc<JsonMember, KnownBounds>(
+			  DAW_FWD( json_data ), arena.get_allocator( ), flags );
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
+#endif
@@ -0,0 +1,324 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "impl/daw_json_arrow_proxy.h"
+#include "impl/daw_json_link_types_fwd.h"
+#include "impl/daw_json_parse_class.h"
+#include "impl/daw_json_parse_value_fwd.h"
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <ios>
+#include <istream>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/***
+		 * Parse the elements of a JSON array read from a std::FILE * or
+		 * std::istream one at a time.  The stream is read through a window that
+		 * is refilled as the elements are consumed, so memory stays at the window
+		 * size no matter how large the document is.  The window only grows when
+		 * a single element does not fit in it.
+		 *
+		 * Elements are found with a scan of their brackets and strings, and each
+		 * is then parsed with a parse state over just its bytes.  Values that
+		 * refer into the document, like std::string_view members, are only valid
+		 * until the iterator is incremented.
+		 * @tparam JsonElement type of the elements in the array
+		 * @tparam PolicyFlags Parse options for the elements
+		 */
+		template<typename JsonElement, auto... PolicyFlags>
+		class json_array_stream {
+			using ParseState =
+			  json_details::no_insitu_strings_policy_t<TryDefaultParsePolicy<
+			    BasicParsePolicy<options::details::make_parse_flags<PolicyFlags...>( )
+			                       .value>>>;
+			using read_fn_t = std::size_t ( * )( void *, char *, std::size_t );
+
+		public:
+			using element_type = json_details::json_deduced_type<JsonElement>;
+			static_assert( not std::is_same_v<element_type, void>,
+			               "Unknown JsonElement type." );
+			using value_type = json_details::json_result_t<element_type>;
+
+			static constexpr std::size_t default_window_size = 256U * 1024U;
+
+			/// @brief An input iterator over the elements of a json_array_stream,
+			/// with the interface of json_array_iterator
+			class iterator {
+				json_array_stream *m_stream = nullptr;
+
+			public:
+				using value_type = typename json_array_stream::value_type;
+				using reference = value_type;
+				using pointer = json_details::arrow_proxy<value_type>;
+				using difference_type = std::ptrdiff_t;
+				using iterator_category = std::input_iterator_tag;
+
+				explicit iterator( ) = default;
+
+				explicit iterator( json_array_stream *stream )
+				  : m_stream( stream != nullptr and stream->m_has_element ? stream
+				                                                          : nullptr ) {}
+
+				/// @brief Parse the current element
+				/// @pre good( ) returns true
+				[[nodiscard]] value_type operator*( ) const {
+					daw_json_ensure( good( ), ErrorReason::UnexpectedEndOfData );
+					return m_stream->parse_current( );
+				}
+
+				[[nodiscard]] pointer operator->( ) const {
+					return pointer{ operator*( ) };
+				}
+
+				/// @brief Move to the next element, reading more of the stream
+				/// when needed
+				iterator &operator++( ) {
+					daw_json_ensure( good( ), ErrorReason::UnexpectedEndOfData );
+					m_stream->next( );
+					if( not m_stream->m_has_element ) {
+						m_stream = nullptr;
+					}
+					return *this;
+				}
+
+				void operator++( int ) & {
+					(void)operator++( );
+				}
+
+				[[nodiscard]] bool good( ) const {
+					return m_stream != nullptr;
+				}
+
+				[[nodiscard]] explicit operator bool( ) const {
+					return good( );
+				}
+
+				[[nodiscard]] bool operator==( iterator const &rhs ) const {
+					return m_stream == rhs.m_stream;
+				}
+
+				[[nodiscard]] bool operator!=( iterator const &rhs ) const {
+					return m_stream != rhs.m_stream;
+				}
+			};
+
+		private:
+			void *m_source;
+			read_fn_t m_read;
+			std::vector<char> m_buffer;
+			/// Offset of the current element, or of the next unread byte between
+			/// elements
+			std::size_t m_pos = 0;
+			/// Number of bytes of m_buffer holding data
+			std::size_t m_size = 0;
+			/// Size of the current element
+			std::size_t m_element_size = 0;
+			bool m_is_eof = false;
+			bool m_has_element = false;
+
+			static std::size_t read_file( void *source, char *buffer,
+			                              std::size_t size ) {
+				auto *const f = static_cast<std::FILE *>( source );
+				auto const count = std::fread( buffer, 1, size, f );
+				daw_json_ensure( count == size or not std::ferror( f ),
+				                 ErrorReason::UnexpectedEndOfData );
+				return count;
+			}
+
+			static std::size_t read_istream( void *source, char *buffer,
+			                                 std::size_t size ) {
+				auto &is = *static_cast<std::istream *>( source );
+				is.read( buffer, static_cast<std::streamsize>( size ) );
+				daw_json_ensure( not is.bad( ), ErrorReason::UnexpectedEndOfData );
+				return static_cast<std::size_t>( is.gcount( ) );
+			}
+
+			[[nodiscard]] static constexpr bool is_whitespace( char c ) {
+				return c == ' ' or c == '\t' or c == '\n' or c == '\r';
+			}
+
+			/// @brief Move the bytes from m_pos on to the front of the window and
+			/// read more after them.  The window doubles when it is full
+			/// @return false at the end of the stream
+			bool refill( ) {
+				if( m_is_eof ) {
+					return false;
+				}
+				if( m_pos > 0 ) {
+					std::memmove( m_buffer.data( ), m_buffer.data( ) + m_pos,
+					              m_size - m_pos );
+					m_size -= m_pos;
+					m_pos = 0;
+				}
+				if( m_size == m_buffer.size( ) ) {
+					m_buffer.resize( m_buffer.size( ) * 2U );
+				}
+				auto const count = m_read( m_source, m_buffer.data( ) + m_size,
+				                           m_buffer.size( ) - m_size );
+				if( count == 0 ) {
+					m_is_eof = true;
+					return false;
+				}
+				m_size += count;
+				return true;
+			}
+
+			/// @brief Make the byte at offset n from m_pos available
+			/// @return false when the stream ends before it
+			[[nodiscard]] bool has_byte( std::size_t n ) {
+				while( m_pos + n >= m_size ) {
+					if( not refill( ) ) {
+						return false;
+					}
+				}
+				return true;
+			}
+
+			[[nodiscard]] char byte_at( std::size_t n ) const {
+				return m_buffer[m_pos + n];
+			}
+
+			void skip_whitespace( ) {
+				while( has_byte( 0 ) and is_whitespace( byte_at( 0 ) ) ) {
+					++m_pos;
+				}
+			}
+
+			/// @brief Find the size of the element at m_pos, reading until all of
+			/// it is in the window
+			void find_element_end( ) {
+				std::size_t n = 0;
+				char const c = byte_at( 0 );
+				if( c == '"' or c == '{' or c == '[' ) {
+					std::size_t depth = 0;
+					bool in_string = false;
+					do {
+						daw_json_ensure( has_byte( n ), ErrorReason::UnexpectedEndOfData );
+						char const b = byte_at( n++ );
+						if( in_string ) {
+							if( b == '\\' ) {
+								++n;
+							} else if( b == '"' ) {
+								in_string = false;
+							}
+						} else if( b == '"' ) {
+							in_string = true;
+						} else if( b == '{' or b == '[' ) {
+							++depth;
+						} else if( b == '}' or b == ']' ) {
+							--depth;
+						}
+					} while( in_string or depth > 0 );
+				} else {
+					while( has_byte( n ) and byte_at( n ) != ',' and
+					       byte_at( n ) != ']' and byte_at( n ) != '}' and
+					       not is_whitespace( byte_at( n ) ) ) {
+						++n;
+					}
+				}
+				m_element_size = n;
+			}
+
+			void next( ) {
+				m_pos += m_element_size;
+				m_element_size = 0;
+				skip_whitespace( );
+				daw_json_ensure( has_byte( 0 ), ErrorReason::UnexpectedEndOfData );
+				if( byte_at( 0 ) == ']' ) {
+					++m_pos;
+					m_has_element = false;
+					return;
+				}
+				daw_json_ensure( byte_at( 0 ) == ',',
+				                 ErrorReason::ExpectedTokenNotFound );
+				++m_pos;
+				skip_whitespace( );
+				daw_json_ensure( has_byte( 0 ), ErrorReason::UnexpectedEndOfData );
+				daw_json_ensure( byte_at( 0 ) != ']', ErrorReason::TrailingComma );
+				find_element_end( );
+			}
+
+			[[nodiscard]] value_type parse_current( ) const {
+				char const *const first = m_buffer.data( ) + m_pos;
+				auto state = ParseState( first, first + m_element_size );
+				auto result =
+				  json_details::parse_value<element_type, false,
+				                            element_type::expected_type>( state );
+				// The value must be the whole element, 12a or truex are not valid
+				state.trim_left( );
+				daw_json_ensure( state.empty( ), ErrorReason::InvalidEndOfValue,
+				                 state );
+				return result;
+			}
+
+			json_array_stream( void *source, read_fn_t read,
+			                   std::size_t window_size )
+			  : m_source( source )
+			  , m_read( read )
+			  , m_buffer( window_size < 64U ? 64U : window_size ) {
+				skip_whitespace( );
+				daw_json_ensure( has_byte( 0 ) and byte_at( 0 ) == '[',
+				                 ErrorReason::InvalidArrayStart );
+				++m_pos;
+				skip_whitespace( );
+				daw_json_ensure( has_byte( 0 ), ErrorReason::UnexpectedEndOfData );
+				if( byte_at( 0 ) == ']' ) {
+					++m_pos;
+					return;
+				}
+				m_has_element = true;
+				find_element_end( );
+			}
+
+		public:
+			/// @brief Read a JSON array from a std::FILE *, starting at its current
+			/// position.  The file must stay open while iterating
+			/// @param window_size The number of bytes read at a time
+			explicit json_array_stream(
+			  std::FILE *f, std::size_t window_size = default_window_size )
+			  : json_array_stream( f, &read_file, window_size ) {}
+
+			/// @brief Read a JSON array from a std::istream, starting at its
+			/// current position.  The stream must outlive the iteration
+			/// @param window_size The number of bytes read at a time
+			explicit json_array_stream(
+			  std::istream &is, std::size_t window_size = default_window_size )
+			  : json_array_stream( &is, &read_istream, window_size ) {}
+
+			// Iterators point back at the stream
+			json_array_stream( json_array_stream const & ) = delete;
+			json_array_stream &operator=( json_array_stream const & ) = delete;
+
+			/// @return An iterator to the current element.  As with
+			/// std::istream_iterator, every iterator shares the stream's position
+			[[nodiscard]] iterator begin( ) {
+				return iterator( this );
+			}
+
+			[[nodiscard]] iterator end( ) {
+				return iterator( );
+			}
+
+			/// @return The size of the window, larger than requested only when
+			/// an element did not fit
+			[[nodiscard]] std::size_t window_size( ) const {
+				return m_buffer.size( );
+			}
+		};
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
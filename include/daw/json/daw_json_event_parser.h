@@ -21,6 +21,7 @@
 #include <daw/stdinc/declval.h>
 #include <daw/stdinc/move_fwd_exch.h>
 #include <optional>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -315,6 +316,98 @@ namespace daw::json {
 			}
 		};
 
+		/***
+		 * A stack for json_event_parser that is an inline array of MaxDepth
+		 * values, so parsing does not allocate.  A document nested deeper than
+		 * MaxDepth classes and arrays is an error of
+		 * ErrorReason::MaxNestingDepthExceeded
+		 */
+		template<typename StackValue, std::size_t MaxDepth>
+		class FixedDepthJsonEventParserStackPolicy {
+			static_assert( MaxDepth > 0, "The stack must hold the root value" );
+			StackValue m_stack[MaxDepth];
+			std::size_t m_size = 0;
+
+		public:
+			using value_type = StackValue;
+			using reference = StackValue &;
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+
+			FixedDepthJsonEventParserStackPolicy( ) = default;
+
+			CPP20CONSTEXPR void push_back( value_type &&v ) {
+				daw_json_ensure( m_size < MaxDepth,
+				                 ErrorReason::MaxNestingDepthExceeded );
+				m_stack[m_size++] = std::move( v );
+			}
+
+			[[nodiscard]] CPP20CONSTEXPR reference back( ) {
+				return m_stack[m_size - 1];
+			}
+
+			CPP20CONSTEXPR void clear( ) {
+				m_size = 0;
+			}
+
+			CPP20CONSTEXPR void pop_back( ) {
+				--m_size;
+			}
+
+			[[nodiscard]] CPP20CONSTEXPR bool empty( ) const {
+				return m_size == 0;
+			}
+		};
+
+		/***
+		 * Pass as the StackContainerPolicy of json_event_parser to use a
+		 * FixedDepthJsonEventParserStackPolicy of MaxDepth.  A Handler with a
+		 * static constexpr std::size_t max_nesting_depth member gets one of that
+		 * depth by default
+		 */
+		template<std::size_t MaxDepth>
+		struct json_event_parser_max_depth {};
+
+		namespace json_details {
+			DAW_JSON_MAKE_REQ_TRAIT( has_max_nesting_depth_v,
+			                         T::max_nesting_depth );
+
+			template<typename StackContainerPolicy, typename Handler,
+			         typename StackValue, typename = void>
+			struct event_parser_stack_policy {
+				using type = StackContainerPolicy;
+			};
+
+			template<typename Handler, typename StackValue>
+			struct event_parser_stack_policy<
+			  use_default, Handler, StackValue,
+			  std::enable_if_t<not has_max_nesting_depth_v<Handler>>> {
+				using type = DefaultJsonEventParserStackPolicy<StackValue>;
+			};
+
+			template<typename Handler, typename StackValue>
+			struct event_parser_stack_policy<
+			  use_default, Handler, StackValue,
+			  std::enable_if_t<has_max_nesting_depth_v<Handler>>> {
+				using type =
+				  FixedDepthJsonEventParserStackPolicy<StackValue,
+				                                       Handler::max_nesting_depth>;
+			};
+
+			template<std::size_t MaxDepth, typename Handler, typename StackValue>
+			struct event_parser_stack_policy<json_event_parser_max_depth<MaxDepth>,
+			                                 Handler, StackValue> {
+				using type = FixedDepthJsonEventParserStackPolicy<StackValue, MaxDepth>;
+			};
+
+			template<typename StackContainerPolicy, typename Handler,
+			         typename StackValue>
+			using event_parser_stack_policy_t =
+			  typename event_parser_stack_policy<StackContainerPolicy,
+			                                     daw::remove_cvref_t<Handler>,
+			                                     StackValue>::type;
+		} // namespace json_details
+
 		template<json_options_t P, typename A,
 		         typename StackContainerPolicy = use_default, typename Handler,
 		         auto... ParseFlags>
@@ -322,8 +415,10 @@ namespace daw::json {
 		json_event_parser( basic_json_value<P, A> bjv, Handler &&handler,
 		                   options::parse_flags_t<ParseFlags...> ) {
 
-			using ParseState = TryDefaultParsePolicy<typename BasicParsePolicy<
-			  P, A>::template SetPolicyOptions<ParseFlags...>>;
+			using ParseState =
+			  json_details::no_insitu_strings_policy_t<TryDefaultParsePolicy<
+			    typename BasicParsePolicy<P, A>::template SetPolicyOptions<
+			      ParseFlags...>>>;
 
 			using iterator =
 			  basic_json_value_iterator<ParseState::policy_flags( ), A>;
@@ -332,13 +427,9 @@ namespace daw::json {
 			  JsonEventParserStackValue<ParseState::policy_flags( ), A>;
 			auto jvalue = basic_json_value( bjv );
 
-			auto parent_stack = [] {
-				if constexpr( std::is_same_v<StackContainerPolicy, use_default> ) {
-					return DefaultJsonEventParserStackPolicy<stack_value_t>{ };
-				} else {
-					return StackContainerPolicy{ };
-				}
-			}( );
+			auto parent_stack =
+			  json_details::event_parser_stack_policy_t<StackContainerPolicy,
+			                                            Handler, stack_value_t>{ };
 			long long class_depth = 0;
 			long long array_depth = 0;
 
@@ -527,26 +618,38 @@ namespace daw::json {
 		         typename StackContainerPolicy = use_default, typename Handler>
 		inline constexpr void json_event_parser( basic_json_value<P, A> bjv,
 		                                         Handler &&handler ) {
-			json_event_parser( std::move( bjv ), DAW_FWD( handler ),
-			                   options::parse_flags<> );
+			json_event_parser<P, A, StackContainerPolicy>(
+			  std::move( bjv ), DAW_FWD( handler ), options::parse_flags<> );
 		}
 
-		template<typename Handler, auto... ParseFlags>
+		/***
+		 * Parse json_document, calling the members of handler for each event.
+		 * StackContainerPolicy comes after Handler so that
+		 * json_event_parser<Handler>( doc, handler ) keeps working, e.g.
+		 * json_event_parser<Handler &, json_event_parser_max_depth<16>>( doc,
+		 * handler )
+		 */
+		template<typename Handler, typename StackContainerPolicy = use_default,
+		         auto... ParseFlags>
 		inline void
 		json_event_parser( daw::string_view json_document, Handler &&handler,
 		                   options::parse_flags_t<ParseFlags...> pflags ) {
 
-			return json_event_parser( basic_json_value( json_document ),
-			                          DAW_FWD2( Handler, handler ), pflags );
+			return json_event_parser<json_details::default_policy_flag,
+			                         json_details::NoAllocator,
+			                         StackContainerPolicy>(
+			  json_value( json_document ), DAW_FWD2( Handler, handler ), pflags );
 		}
 
-		template<typename Handler>
+		template<typename Handler, typename StackContainerPolicy = use_default>
 		inline void json_event_parser( daw::string_view json_document,
 		                               Handler &&handler ) {
 
-			return json_event_parser( basic_json_value( json_document ),
-			                          DAW_FWD2( Handler, handler ),
-			                          options::parse_flags<> );
+			return json_event_parser<json_details::default_policy_flag,
+			                         json_details::NoAllocator,
+			                         StackContainerPolicy>(
+			  json_value( json_document ), DAW_FWD2( Handler, handler ),
+			  options::parse_flags<> );
 		}
 
 	} // namespace DAW_JSON_VER
@@ -0,0 +1,448 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_json_event_parser.h"
+
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			/// @brief What the stream parser accepts next, outside of a token
+			enum class stream_expect : unsigned char {
+				value,
+				value_or_array_end,
+				name,
+				name_or_class_end,
+				colon,
+				comma_or_end,
+				done
+			};
+
+			/// @brief The kind of token that is being read, it may span chunks
+			enum class stream_token : unsigned char { none, string, number, literal };
+
+			[[nodiscard]] constexpr bool is_stream_whitespace( char c ) {
+				return c == ' ' or c == '\t' or c == '\n' or c == '\r';
+			}
+
+			[[nodiscard]] constexpr bool is_stream_number_char( char c ) {
+				return ( c >= '0' and c <= '9' ) or c == '-' or c == '+' or
+				       c == '.' or c == 'e' or c == 'E';
+			}
+		} // namespace json_details
+
+		/***
+		 * A push parser for documents that arrive in pieces, e.g. from a socket
+		 * or a decompressor.  Each chunk passed to push is parsed as far as it
+		 * goes and the parser resumes at the next chunk, even in the middle of a
+		 * string, escape, number, or literal.  The events and handlers are those
+		 * of json_event_parser.  Chunks do not need to outlive push; the only
+		 * data kept between them is the unfinished token, the pending member name
+		 * and the nesting of classes and arrays, so memory is bounded by the
+		 * largest token rather than by the document.
+		 *
+		 * The values passed to the handler only hold their own text.  For
+		 * numbers, strings, bools and null that is the whole value, but the value
+		 * passed to handle_on_class_start and handle_on_array_start is only the
+		 * opening bracket; its type can be checked but it cannot be iterated.
+		 * Comments are not supported.
+		 * @tparam Handler The event handler, see json_event_parser
+		 * @tparam ParseFlags Parse options for the values passed to the handler
+		 */
+		template<typename Handler, auto... ParseFlags>
+		class json_event_stream_parser {
+			using ParseState =
+			  json_details::no_insitu_strings_policy_t<TryDefaultParsePolicy<
+			    BasicParsePolicy<options::details::make_parse_flags<ParseFlags...>( )
+			                       .value>>>;
+			using json_value_t = basic_json_value<ParseState::policy_flags( )>;
+			using json_pair_t = basic_json_pair<ParseState::policy_flags( )>;
+
+			Handler &m_handler;
+			std::vector<StackParseStateType> m_stack{ };
+			std::string m_token_buffer{ };
+			std::string m_name_buffer{ };
+			std::optional<std::string_view> m_name{ };
+			std::size_t m_skip_depth = 0;
+			json_details::stream_expect m_expect =
+			  json_details::stream_expect::value;
+			json_details::stream_token m_token = json_details::stream_token::none;
+			bool m_token_is_name = false;
+			bool m_is_escaped = false;
+			bool m_name_in_chunk = false;
+			bool m_is_skipping = false;
+			bool m_skip_in_string = false;
+			bool m_is_complete = false;
+
+			/// @return false when the handler does not want to continue with the
+			/// current value
+			bool process_result( json_details::handler_result_holder result,
+			                     std::size_t skip_depth ) {
+				switch( result.value ) {
+				case json_parse_handler_result::Complete:
+					m_is_complete = true;
+					return false;
+				case json_parse_handler_result::SkipClassArray:
+					if( m_stack.empty( ) ) {
+						// Nothing is left of the document after the root value
+						m_is_complete = true;
+					} else {
+						m_is_skipping = true;
+						m_skip_in_string = false;
+						m_skip_depth = skip_depth;
+					}
+					return false;
+				case json_parse_handler_result::Continue:
+					break;
+				}
+				return true;
+			}
+
+			void value_done( ) {
+				m_expect = m_stack.empty( ) ? json_details::stream_expect::done
+				                            : json_details::stream_expect::comma_or_end;
+			}
+
+			void emit_value( std::string_view text ) {
+				auto jv = json_value_t( daw::string_view( text ) );
+				auto const is_container = text == "{" or text == "[";
+				auto const skip_depth =
+				  is_container ? std::size_t{ 1 } : std::size_t{ 0 };
+				auto name = std::exchange( m_name, std::nullopt );
+				if( not process_result(
+				      json_details::handle_on_value( m_handler,
+				                                     json_pair_t{ name, jv } ),
+				      skip_depth ) ) {
+					return;
+				}
+				switch( jv.type( ) ) {
+				case JsonBaseParseTypes::Array:
+					if( process_result(
+					      json_details::handle_on_array_start( m_handler, jv ),
+					      skip_depth ) ) {
+						m_stack.push_back( StackParseStateType::Array );
+						m_expect = json_details::stream_expect::value_or_array_end;
+					}
+					return;
+				case JsonBaseParseTypes::Class:
+					if( process_result(
+					      json_details::handle_on_class_start( m_handler, jv ),
+					      skip_depth ) ) {
+						m_stack.push_back( StackParseStateType::Class );
+						m_expect = json_details::stream_expect::name_or_class_end;
+					}
+					return;
+				case JsonBaseParseTypes::Number:
+					if( not process_result(
+					      json_details::handle_on_number( m_handler, jv ), 0 ) ) {
+						return;
+					}
+					break;
+				case JsonBaseParseTypes::Bool:
+					if( not process_result(
+					      json_details::handle_on_bool( m_handler, jv ), 0 ) ) {
+						return;
+					}
+					break;
+				case JsonBaseParseTypes::String:
+					if( not process_result(
+					      json_details::handle_on_string( m_handler, jv ), 0 ) ) {
+						return;
+					}
+					break;
+				case JsonBaseParseTypes::Null:
+					if( not process_result(
+					      json_details::handle_on_null( m_handler, jv ), 0 ) ) {
+						return;
+					}
+					break;
+				case JsonBaseParseTypes::None:
+				default:
+					if( not process_result(
+					      json_details::handle_on_error( m_handler, jv ), 0 ) ) {
+						return;
+					}
+					break;
+				}
+				value_done( );
+			}
+
+			void close_container( StackParseStateType type ) {
+				daw_json_ensure( not m_stack.empty( ) and m_stack.back( ) == type,
+				                 ErrorReason::InvalidBracketing );
+				m_stack.pop_back( );
+				auto const result = type == StackParseStateType::Class
+				                      ? json_details::handle_on_class_end( m_handler )
+				                      : json_details::handle_on_array_end( m_handler );
+				if( result.value == json_parse_handler_result::Complete ) {
+					m_is_complete = true;
+					return;
+				}
+				value_done( );
+			}
+
+			void token_done( std::string_view text, bool is_in_chunk ) {
+				auto const token = std::exchange( m_token,
+				                                  json_details::stream_token::none );
+				if( m_token_is_name ) {
+					if( not is_in_chunk ) {
+						m_name_buffer.swap( m_token_buffer );
+						text = m_name_buffer;
+					}
+					m_name = text.substr( 1, text.size( ) - 2 );
+					m_name_in_chunk = is_in_chunk;
+					m_expect = json_details::stream_expect::colon;
+				} else {
+					if( token == json_details::stream_token::literal ) {
+						daw_json_ensure( text == "true" or text == "false" or
+						                   text == "null",
+						                 ErrorReason::InvalidLiteral );
+					}
+					emit_value( text );
+				}
+				m_token_buffer.clear( );
+			}
+
+			/// @brief Read the rest of the current token
+			/// @return The position after the token, or last when it continues in
+			/// the next chunk
+			char const *continue_token( char const *token_first, char const *first,
+			                            char const *const last ) {
+				switch( m_token ) {
+				case json_details::stream_token::string:
+					while( first < last ) {
+						char const c = *first++;
+						if( m_is_escaped ) {
+							m_is_escaped = false;
+						} else if( c == '\\' ) {
+							m_is_escaped = true;
+						} else if( c == '"' ) {
+							finish_token( token_first, first );
+							return first;
+						}
+					}
+					return last;
+				case json_details::stream_token::number:
+					while( first < last and
+					       json_details::is_stream_number_char( *first ) ) {
+						++first;
+					}
+					break;
+				case json_details::stream_token::literal:
+					while( first < last and *first >= 'a' and *first <= 'z' ) {
+						++first;
+					}
+					break;
+				case json_details::stream_token::none:
+					break;
+				}
+				if( first < last ) {
+					finish_token( token_first, first );
+				}
+				return first;
+			}
+
+			void finish_token( char const *token_first, char const *token_last ) {
+				if( m_token_buffer.empty( ) ) {
+					auto const size =
+					  static_cast<std::size_t>( token_last - token_first );
+					token_done( std::string_view( token_first, size ), true );
+				} else {
+					m_token_buffer.append( token_first, token_last );
+					token_done( m_token_buffer, false );
+				}
+			}
+
+			/// @brief Skip to the end of the class or array the handler asked to
+			/// skip, leaving its closing bracket to be parsed
+			char const *skip( char const *first, char const *const last ) {
+				while( first < last ) {
+					char const c = *first;
+					if( m_skip_in_string ) {
+						if( m_is_escaped ) {
+							m_is_escaped = false;
+						} else if( c == '\\' ) {
+							m_is_escaped = true;
+						} else if( c == '"' ) {
+							m_skip_in_string = false;
+						}
+					} else if( c == '"' ) {
+						m_skip_in_string = true;
+					} else if( c == '{' or c == '[' ) {
+						++m_skip_depth;
+					} else if( c == '}' or c == ']' ) {
+						if( m_skip_depth == 0 ) {
+							m_is_skipping = false;
+							m_expect = json_details::stream_expect::comma_or_end;
+							return first;
+						}
+						--m_skip_depth;
+					}
+					++first;
+				}
+				return first;
+			}
+
+			void start_token( json_details::stream_token token, bool is_name ) {
+				m_token = token;
+				m_token_is_name = is_name;
+				m_is_escaped = false;
+			}
+
+			/// @return The position after the structural character or the first
+			/// character of the value
+			char const *parse_structural( char const *first ) {
+				char const c = *first;
+				switch( m_expect ) {
+				case json_details::stream_expect::value_or_array_end:
+					if( c == ']' ) {
+						close_container( StackParseStateType::Array );
+						return first + 1;
+					}
+					[[fallthrough]];
+				case json_details::stream_expect::value:
+					switch( c ) {
+					case '{':
+					case '[':
+						emit_value( std::string_view( first, 1 ) );
+						return first + 1;
+					case '"':
+						start_token( json_details::stream_token::string, false );
+						return first + 1;
+					case 't':
+					case 'f':
+					case 'n':
+						start_token( json_details::stream_token::literal, false );
+						return first + 1;
+					default:
+						daw_json_ensure( c == '-' or ( c >= '0' and c <= '9' ),
+						                 ErrorReason::InvalidStartOfValue );
+						start_token( json_details::stream_token::number, false );
+						return first + 1;
+					}
+				case json_details::stream_expect::name_or_class_end:
+					if( c == '}' ) {
+						close_container( StackParseStateType::Class );
+						return first + 1;
+					}
+					[[fallthrough]];
+				case json_details::stream_expect::name:
+					daw_json_ensure( c == '"', ErrorReason::InvalidMemberName );
+					start_token( json_details::stream_token::string, true );
+					return first + 1;
+				case json_details::stream_expect::colon:
+					daw_json_ensure( c == ':', ErrorReason::ExpectedTokenNotFound );
+					m_expect = json_details::stream_expect::value;
+					return first + 1;
+				case json_details::stream_expect::comma_or_end:
+					switch( c ) {
+					case ',':
+						m_expect = m_stack.back( ) == StackParseStateType::Class
+						             ? json_details::stream_expect::name
+						             : json_details::stream_expect::value;
+						return first + 1;
+					case '}':
+						close_container( StackParseStateType::Class );
+						return first + 1;
+					case ']':
+						close_container( StackParseStateType::Array );
+						return first + 1;
+					default:
+						daw_json_error( ErrorReason::InvalidEndOfValue );
+					}
+				case json_details::stream_expect::done:
+				default:
+					daw_json_error( ErrorReason::InvalidEndOfValue );
+				}
+			}
+
+		public:
+			explicit json_event_stream_parser( Handler &handler )
+			  : m_handler( handler ) {}
+
+			explicit json_event_stream_parser( Handler &handler,
+			                                   options::parse_flags_t<ParseFlags...> )
+			  : m_handler( handler ) {}
+
+			/// @brief Parse the next piece of the document.  It can end anywhere,
+			/// including inside of a token
+			/// @throws daw::json::json_exception
+			void push( daw::string_view chunk ) {
+				char const *first = std::data( chunk );
+				char const *const last = daw::data_end( chunk );
+				char const *token_first = first;
+				while( first < last and not m_is_complete ) {
+					if( m_is_skipping ) {
+						first = skip( first, last );
+					} else if( m_token != json_details::stream_token::none ) {
+						first = continue_token( token_first, first, last );
+					} else if( json_details::is_stream_whitespace( *first ) ) {
+						++first;
+					} else {
+						token_first = first;
+						first = parse_structural( first );
+					}
+				}
+				if( m_is_complete ) {
+					return;
+				}
+				if( m_token != json_details::stream_token::none ) {
+					m_token_buffer.append( token_first, last );
+				}
+				if( m_name and m_name_in_chunk ) {
+					m_name_buffer.assign( m_name->data( ), m_name->size( ) );
+					m_name = m_name_buffer;
+					m_name_in_chunk = false;
+				}
+			}
+
+			/// @brief Signal the end of the document.  A number or literal at the
+			/// end of the last chunk is completed, and the document must be whole
+			/// @throws daw::json::json_exception
+			void finish( ) {
+				if( m_is_complete ) {
+					return;
+				}
+				if( m_token == json_details::stream_token::number or
+				    m_token == json_details::stream_token::literal ) {
+					token_done( m_token_buffer, false );
+				}
+				daw_json_ensure( m_token == json_details::stream_token::none and
+				                   m_expect == json_details::stream_expect::done,
+				                 ErrorReason::UnexpectedEndOfData );
+			}
+
+			/// @return true once the whole root value has been parsed or the
+			/// handler has asked to stop
+			[[nodiscard]] bool is_complete( ) const {
+				return m_is_complete or
+				       ( m_token == json_details::stream_token::none and
+				         m_expect == json_details::stream_expect::done );
+			}
+		};
+
+		template<typename Handler>
+		json_event_stream_parser( Handler & ) -> json_event_stream_parser<Handler>;
+
+		template<typename Handler, auto... ParseFlags>
+		json_event_stream_parser( Handler &, options::parse_flags_t<ParseFlags...> )
+		  -> json_event_stream_parser<Handler, ParseFlags...>;
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -87,7 +87,9 @@ namespace daw::json {
 			ExpectedTokenNotFound,
 			UnexpectedJSONVariantType,
 			TrailingComma,
-			AttemptToCallOpStarOnConstIterator
+			AttemptToCallOpStarOnConstIterator,
+			DocumentTooLarge,
+			MaxNestingDepthExceeded
 		};
 
 		constexpr std::string_view reason_message( ErrorReason er ) {
@@ -189,6 +191,10 @@ namespace daw::json {
 				return "Trailing comma"sv;
 			case ErrorReason::AttemptToCallOpStarOnConstIterator:
 				return "Use of operator*( ) on const iterator";
+			case ErrorReason::DocumentTooLarge:
+				return "Document is larger than supported"sv;
+			case ErrorReason::MaxNestingDepthExceeded:
+				return "Nesting depth is larger than the maximum supported"sv;
 			}
 			DAW_UNREACHABLE( );
 		}
@@ -213,8 +213,9 @@ namespace daw::json {
 		template<typename JsonElement, auto... PolicyFlags>
 		using json_array_iterator = json_array_iterator_t<
 		  JsonElement,
-		  TryDefaultParsePolicy<BasicParsePolicy<
-		    options::details::make_parse_flags<PolicyFlags...>( ).value>>>;
+		  json_details::no_insitu_strings_policy_t<TryDefaultParsePolicy<
+		    BasicParsePolicy<options::details::make_parse_flags<PolicyFlags...>( )
+		                       .value>>>>;
 		/// Iterator for iterating over JSON array's. Requires that op
 		/// op++ be called in that sequence one time until end is reached
 		/// @tparam JsonElement type under underlying element in array.If
@@ -222,8 +223,10 @@ namespace daw::json {
 		/// @tparam ParsePolicy Parsing policy type
 		template<typename JsonElement, auto... PolicyFlags>
 		class json_array_iterator_once {
-			using ParseState = TryDefaultParsePolicy<BasicParsePolicy<
-			  options::details::make_parse_flags<PolicyFlags...>( ).value>>;
+			using ParseState =
+			  json_details::no_insitu_strings_policy_t<TryDefaultParsePolicy<
+			    BasicParsePolicy<options::details::make_parse_flags<PolicyFlags...>( )
+			                       .value>>>;
 			using CharT = typename ParseState::CharT;
 
 			static constexpr ParseState get_range( daw::string_view data,
@@ -354,8 +357,10 @@ namespace daw::json {
 		/// @tparam ParsePolicy parsing policy type
 		template<typename JsonElement, auto... PolicyFlags>
 		struct json_array_range {
-			using ParsePolicy = TryDefaultParsePolicy<BasicParsePolicy<
-			  options::details::make_parse_flags<PolicyFlags...>( ).value>>;
+			using ParsePolicy =
+			  json_details::no_insitu_strings_policy_t<TryDefaultParsePolicy<
+			    BasicParsePolicy<options::details::make_parse_flags<PolicyFlags...>( )
+			                       .value>>>;
 			using iterator = json_array_iterator<JsonElement, PolicyFlags...>;
 			using CharT = typename ParsePolicy::CharT;
 
@@ -396,8 +401,10 @@ namespace daw::json {
 		/// @tparam ParsePolicy parsing policy type
 		template<typename JsonElement, auto... PolicyFlags>
 		struct json_array_range_once {
-			using ParsePolicy = TryDefaultParsePolicy<BasicParsePolicy<
-			  options::details::make_parse_flags<PolicyFlags...>( ).value>>;
+			using ParsePolicy =
+			  json_details::no_insitu_strings_policy_t<TryDefaultParsePolicy<
+			    BasicParsePolicy<options::details::make_parse_flags<PolicyFlags...>( )
+			                       .value>>>;
 			using iterator = json_array_iterator_once<JsonElement, PolicyFlags...>;
 			using CharT = typename ParsePolicy::CharT;
 
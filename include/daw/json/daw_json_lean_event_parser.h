@@ -0,0 +1,487 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_json_event_parser.h"
+#include "daw_json_exception.h"
+#include "impl/daw_json_assert.h"
+#include "impl/daw_json_parse_policy.h"
+#include "impl/daw_json_parse_real.h"
+#include "impl/daw_json_parse_string_need_slow.h"
+#include "impl/daw_json_parse_unsigned_int.h"
+#include "impl/daw_json_skip.h"
+
+#include <daw/daw_data_end.h>
+#include <daw/daw_move.h>
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <daw/stdinc/declval.h>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			namespace lean_checks {
+				DAW_JSON_MAKE_REQ_TRAIT( has_on_class_start_v,
+				                         std::declval<T &>( ).on_class_start( ) );
+
+				DAW_JSON_MAKE_REQ_TRAIT( has_on_class_end_v,
+				                         std::declval<T &>( ).on_class_end( ) );
+
+				DAW_JSON_MAKE_REQ_TRAIT( has_on_array_start_v,
+				                         std::declval<T &>( ).on_array_start( ) );
+
+				DAW_JSON_MAKE_REQ_TRAIT( has_on_array_end_v,
+				                         std::declval<T &>( ).on_array_end( ) );
+
+				DAW_JSON_MAKE_REQ_TRAIT(
+				  has_on_key_escaped_v,
+				  std::declval<T &>( ).on_key( std::string_view( ), true ) );
+
+				DAW_JSON_MAKE_REQ_TRAIT(
+				  has_on_key_v, std::declval<T &>( ).on_key( std::string_view( ) ) );
+
+				DAW_JSON_MAKE_REQ_TRAIT(
+				  has_on_string_escaped_v,
+				  std::declval<T &>( ).on_string( std::string_view( ), true ) );
+
+				DAW_JSON_MAKE_REQ_TRAIT(
+				  has_on_string_v,
+				  std::declval<T &>( ).on_string( std::string_view( ) ) );
+
+				DAW_JSON_MAKE_REQ_TRAIT(
+				  has_on_int64_v, std::declval<T &>( ).on_int64( std::int64_t( ) ) );
+
+				DAW_JSON_MAKE_REQ_TRAIT(
+				  has_on_uint64_v,
+				  std::declval<T &>( ).on_uint64( std::uint64_t( ) ) );
+
+				DAW_JSON_MAKE_REQ_TRAIT( has_on_double_v,
+				                         std::declval<T &>( ).on_double( 0.0 ) );
+
+				DAW_JSON_MAKE_REQ_TRAIT( has_on_bool_v,
+				                         std::declval<T &>( ).on_bool( true ) );
+
+				DAW_JSON_MAKE_REQ_TRAIT( has_on_null_v,
+				                         std::declval<T &>( ).on_null( ) );
+			} // namespace lean_checks
+
+			/// @brief Call a lean handler callback, which can return void, bool,
+			/// or json_parse_handler_result
+			template<typename Callback>
+			DAW_ATTRIB_INLINE constexpr handler_result_holder
+			lean_invoke( Callback &&callback ) {
+				if constexpr( std::is_void_v<decltype( callback( ) )> ) {
+					callback( );
+					return handler_result_holder{ };
+				} else {
+					return callback( );
+				}
+			}
+
+			/// @brief The integer value of a number without a fraction or exponent,
+			/// if it fits in 64 bits
+			struct lean_integer {
+				std::uint64_t magnitude = 0;
+				bool is_negative = false;
+				bool is_valid = false;
+			};
+
+			template<typename ParseState>
+			[[nodiscard]] constexpr lean_integer
+			lean_parse_integer( ParseState number ) {
+				auto result = lean_integer{ };
+				result.is_negative = number.front( ) == '-';
+				if( result.is_negative ) {
+					number.remove_prefix( );
+				}
+				auto const digits = daw::string_view( number.first, number.size( ) );
+				// -9223372036854775808 is the lowest int64 and 18446744073709551615
+				// the highest uint64
+				auto const limit = result.is_negative
+				                     ? daw::string_view( "9223372036854775808" )
+				                     : daw::string_view( "18446744073709551615" );
+				if( digits.size( ) > limit.size( ) or
+				    ( digits.size( ) == limit.size( ) and digits > limit ) ) {
+					return result;
+				}
+				result.magnitude =
+				  unsigned_parser<std::uint64_t, options::JsonRangeCheck::Never, true>(
+				    ParseState::exec_tag, number );
+				result.is_valid = true;
+				return result;
+			}
+
+			/// @brief The state of json_lean_event_parser
+			template<typename Handler, typename ParseState, typename Stack>
+			class lean_event_parser {
+				/// @brief The result of the handler for a value
+				enum class lean_result {
+					/// The value is done
+					Value,
+					/// The value is a class or array, whose members or elements
+					/// follow
+					Opened,
+					/// Skip the rest of the enclosing class or array
+					SkipRest,
+					/// Stop parsing
+					Complete
+				};
+
+				Handler &m_handler;
+				ParseState m_parse_state;
+				Stack m_stack{ };
+
+				static constexpr lean_result
+				to_lean_result( handler_result_holder result ) {
+					switch( result.value ) {
+					case json_parse_handler_result::Complete:
+						return lean_result::Complete;
+					case json_parse_handler_result::SkipClassArray:
+						return lean_result::SkipRest;
+					case json_parse_handler_result::Continue:
+						break;
+					}
+					return lean_result::Value;
+				}
+
+				[[nodiscard]] constexpr lean_result
+				open( StackParseStateType type, handler_result_holder result ) {
+					switch( result.value ) {
+					case json_parse_handler_result::Complete:
+						return lean_result::Complete;
+					case json_parse_handler_result::SkipClassArray:
+						// The handler does not want this class or array
+						(void)skip_value( m_parse_state );
+						return lean_result::Value;
+					case json_parse_handler_result::Continue:
+						break;
+					}
+					m_parse_state.remove_prefix( );
+					m_stack.push_back( std::move( type ) );
+					return lean_result::Opened;
+				}
+
+				[[nodiscard]] constexpr lean_result number( ) {
+					using H = daw::remove_cvref_t<Handler>;
+					constexpr bool has_int64 = lean_checks::has_on_int64_v<H>;
+					constexpr bool has_uint64 = lean_checks::has_on_uint64_v<H>;
+					constexpr bool has_double = lean_checks::has_on_double_v<H>;
+					auto const number = skip_number( m_parse_state );
+					if constexpr( has_int64 or has_uint64 ) {
+						if( number.class_first == nullptr and
+						    number.class_last == nullptr ) {
+							auto const integer = lean_parse_integer( number );
+							constexpr auto int64_max = static_cast<std::uint64_t>(
+							  ( std::numeric_limits<std::int64_t>::max )( ) );
+							if( integer.is_valid and has_int64 and
+							    ( integer.is_negative or integer.magnitude <= int64_max ) ) {
+								if constexpr( has_int64 ) {
+									auto const value =
+									  integer.is_negative
+									    ? static_cast<std::int64_t>( 0U - integer.magnitude )
+									    : static_cast<std::int64_t>( integer.magnitude );
+									return to_lean_result( lean_invoke(
+									  [&] { return m_handler.on_int64( value ); } ) );
+								}
+							} else if( integer.is_valid and not integer.is_negative ) {
+								if constexpr( has_uint64 ) {
+									return to_lean_result( lean_invoke( [&] {
+										return m_handler.on_uint64( integer.magnitude );
+									} ) );
+								}
+							}
+						}
+					}
+					if constexpr( has_double ) {
+						auto value_state = number;
+						auto const value = parse_real<double, true>( value_state );
+						return to_lean_result(
+						  lean_invoke( [&] { return m_handler.on_double( value ); } ) );
+					} else {
+						return lean_result::Value;
+					}
+				}
+
+				/// @brief Parse the value at the front and send its events
+				[[nodiscard]] constexpr lean_result value( ) {
+					using H = daw::remove_cvref_t<Handler>;
+					daw_json_assert_weak( m_parse_state.has_more( ),
+					                      ErrorReason::UnexpectedEndOfData,
+					                      m_parse_state );
+					switch( m_parse_state.front( ) ) {
+					case '{':
+						if constexpr( lean_checks::has_on_class_start_v<H> ) {
+							return open( StackParseStateType::Class,
+							             lean_invoke( [&] {
+								             return m_handler.on_class_start( );
+							             } ) );
+						} else {
+							return open( StackParseStateType::Class,
+							             handler_result_holder{ } );
+						}
+					case '[':
+						if constexpr( lean_checks::has_on_array_start_v<H> ) {
+							return open( StackParseStateType::Array,
+							             lean_invoke( [&] {
+								             return m_handler.on_array_start( );
+							             } ) );
+						} else {
+							return open( StackParseStateType::Array,
+							             handler_result_holder{ } );
+						}
+					case '"': {
+						auto const str = skip_string( m_parse_state );
+						auto const sv = std::string_view( str.first, str.size( ) );
+						if constexpr( lean_checks::has_on_string_escaped_v<H> ) {
+							return to_lean_result( lean_invoke( [&] {
+								return m_handler.on_string( sv, needs_slow_path( str ) );
+							} ) );
+						} else if constexpr( lean_checks::has_on_string_v<H> ) {
+							return to_lean_result(
+							  lean_invoke( [&] { return m_handler.on_string( sv ); } ) );
+						} else {
+							(void)sv;
+							return lean_result::Value;
+						}
+					}
+					case 't':
+					case 'f': {
+						bool const b = m_parse_state.front( ) == 't';
+						if( b ) {
+							(void)skip_true( m_parse_state );
+						} else {
+							(void)skip_false( m_parse_state );
+						}
+						if constexpr( lean_checks::has_on_bool_v<H> ) {
+							return to_lean_result(
+							  lean_invoke( [&] { return m_handler.on_bool( b ); } ) );
+						} else {
+							return lean_result::Value;
+						}
+					}
+					case 'n':
+						(void)skip_null( m_parse_state );
+						if constexpr( lean_checks::has_on_null_v<H> ) {
+							return to_lean_result(
+							  lean_invoke( [&] { return m_handler.on_null( ); } ) );
+						} else {
+							return lean_result::Value;
+						}
+					case '-':
+					case '0':
+					case '1':
+					case '2':
+					case '3':
+					case '4':
+					case '5':
+					case '6':
+					case '7':
+					case '8':
+					case '9':
+						return number( );
+					}
+					daw_json_error( ErrorReason::InvalidStartOfValue, m_parse_state );
+				}
+
+				/// @brief Parse the member name at the front, leaving the parse
+				/// state at its value
+				/// @return SkipRest when the handler wants to skip the value
+				[[nodiscard]] constexpr lean_result key( ) {
+					using H = daw::remove_cvref_t<Handler>;
+					daw_json_assert_weak( m_parse_state.is_quotes_checked( ),
+					                      ErrorReason::MissingMemberNameOrEndOfClass,
+					                      m_parse_state );
+					auto const name = skip_string( m_parse_state );
+					m_parse_state.trim_left( );
+					daw_json_assert_weak( m_parse_state.has_more( ) and
+					                        m_parse_state.front( ) == ':',
+					                      ErrorReason::InvalidMemberName,
+					                      m_parse_state );
+					m_parse_state.remove_prefix( );
+					m_parse_state.trim_left( );
+					auto const sv = std::string_view( name.first, name.size( ) );
+					if constexpr( lean_checks::has_on_key_escaped_v<H> ) {
+						return to_lean_result( lean_invoke( [&] {
+							return m_handler.on_key( sv, needs_slow_path( name ) );
+						} ) );
+					} else if constexpr( lean_checks::has_on_key_v<H> ) {
+						return to_lean_result(
+						  lean_invoke( [&] { return m_handler.on_key( sv ); } ) );
+					} else {
+						(void)sv;
+						return lean_result::Value;
+					}
+				}
+
+				/// @brief Skip the members or elements after the current one, up to
+				/// the end of the innermost class or array
+				constexpr void skip_rest( bool is_class ) {
+					m_parse_state.trim_left( );
+					while( m_parse_state.has_more( ) and
+					       m_parse_state.front( ) == ',' ) {
+						m_parse_state.remove_prefix( );
+						m_parse_state.trim_left( );
+						if( is_class ) {
+							(void)skip_string( m_parse_state );
+							m_parse_state.trim_left( );
+							daw_json_assert_weak( m_parse_state.has_more( ) and
+							                        m_parse_state.front( ) == ':',
+							                      ErrorReason::InvalidMemberName,
+							                      m_parse_state );
+							m_parse_state.remove_prefix( );
+							m_parse_state.trim_left( );
+						}
+						(void)skip_value( m_parse_state );
+						m_parse_state.trim_left( );
+					}
+				}
+
+				[[nodiscard]] constexpr lean_result close( bool is_class ) {
+					using H = daw::remove_cvref_t<Handler>;
+					daw_json_assert_weak( m_parse_state.has_more( ) and
+					                        m_parse_state.front( ) ==
+					                          ( is_class ? '}' : ']' ),
+					                      ErrorReason::InvalidBracketing,
+					                      m_parse_state );
+					m_parse_state.remove_prefix( );
+					m_stack.pop_back( );
+					if( is_class ) {
+						if constexpr( lean_checks::has_on_class_end_v<H> ) {
+							return to_lean_result(
+							  lean_invoke( [&] { return m_handler.on_class_end( ); } ) );
+						}
+					} else {
+						if constexpr( lean_checks::has_on_array_end_v<H> ) {
+							return to_lean_result(
+							  lean_invoke( [&] { return m_handler.on_array_end( ); } ) );
+						}
+					}
+					return lean_result::Value;
+				}
+
+			public:
+				constexpr lean_event_parser( Handler &handler,
+				                             ParseState parse_state )
+				  : m_handler( handler )
+				  , m_parse_state( parse_state ) {}
+
+				constexpr void parse( ) {
+					m_parse_state.trim_left( );
+					daw_json_ensure( m_parse_state.has_more( ),
+					                 ErrorReason::EmptyJSONDocument );
+					auto result = value( );
+					while( result != lean_result::Complete and not m_stack.empty( ) ) {
+						bool const is_class =
+						  m_stack.back( ) == StackParseStateType::Class;
+						if( result == lean_result::SkipRest ) {
+							skip_rest( is_class );
+						}
+						m_parse_state.trim_left( );
+						bool has_next = false;
+						if( result == lean_result::Opened ) {
+							has_next = m_parse_state.has_more( ) and
+							           m_parse_state.front( ) != ( is_class ? '}' : ']' );
+						} else if( m_parse_state.has_more( ) and
+						           m_parse_state.front( ) == ',' ) {
+							m_parse_state.remove_prefix( );
+							m_parse_state.trim_left( );
+							has_next = true;
+						}
+						if( not has_next ) {
+							result = close( is_class );
+							continue;
+						}
+						if( is_class ) {
+							result = key( );
+							if( result == lean_result::Complete ) {
+								break;
+							}
+							if( result == lean_result::SkipRest ) {
+								// The handler does not want the value of this member
+								(void)skip_value( m_parse_state );
+								result = lean_result::Value;
+								continue;
+							}
+						}
+						result = value( );
+					}
+					if( result == lean_result::Complete ) {
+						return;
+					}
+					m_parse_state.trim_left( );
+					if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
+						daw_json_ensure( not m_parse_state.has_more( ),
+						                 ErrorReason::InvalidEndOfValue, m_parse_state );
+					}
+				}
+			};
+		} // namespace json_details
+
+		/***
+		 * An event parser that passes member names as string_views and values
+		 * already converted, without building a json_value for each.  The
+		 * handler opts into events with any of these members, each returning
+		 * void, bool, or json_parse_handler_result
+		 *   on_class_start( ), on_class_end( ), on_array_start( ),
+		 *   on_array_end( )
+		 *   on_key( std::string_view name[, bool needs_unescape] )
+		 *   on_string( std::string_view str[, bool needs_unescape] )
+		 *   on_int64( std::int64_t ), on_uint64( std::uint64_t ),
+		 *   on_double( double )
+		 *   on_bool( bool ), on_null( )
+		 * Names and strings are the text in the document, without the quotes;
+		 * needs_unescape is true when it has escapes.  An integer goes to
+		 * on_int64 when it fits, then to on_uint64, and any other number, or one
+		 * without an integer event, to on_double.  Values without an event are
+		 * skipped, and are validated as json_details::skip_value does.
+		 *
+		 * SkipClassArray from on_class_start or on_array_start skips that
+		 * class or array, from on_key it skips the member's value, and from
+		 * others it skips the rest of the enclosing class or array.  Complete
+		 * stops parsing.
+		 * @tparam StackContainerPolicy The stack of StackParseStateType for the
+		 * open classes and arrays, see json_event_parser
+		 * @param json_document The JSON document to parse
+		 * @param handler The event handler
+		 */
+		template<typename StackContainerPolicy = use_default, typename Handler,
+		         auto... ParseFlags>
+		constexpr void
+		json_lean_event_parser( daw::string_view json_document, Handler &&handler,
+		                        options::parse_flags_t<ParseFlags...> ) {
+			using ParseState =
+			  json_details::no_insitu_strings_policy_t<TryDefaultParsePolicy<
+			    BasicParsePolicy<options::details::make_parse_flags<ParseFlags...>( )
+			                       .value>>>;
+			using Stack =
+			  json_details::event_parser_stack_policy_t<StackContainerPolicy, Handler,
+			                                            StackParseStateType>;
+			using handler_t = std::remove_reference_t<Handler>;
+			auto parser =
+			  json_details::lean_event_parser<handler_t, ParseState, Stack>(
+			    handler, ParseState( std::data( json_document ),
+			                         daw::data_end( json_document ) ) );
+			parser.parse( );
+		}
+
+		template<typename StackContainerPolicy = use_default, typename Handler>
+		constexpr void json_lean_event_parser( daw::string_view json_document,
+		                                       Handler &&handler ) {
+			json_lean_event_parser<StackContainerPolicy>(
+			  json_document, DAW_FWD( handler ), options::parse_flags<> );
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
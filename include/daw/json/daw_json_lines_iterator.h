@@ -13,6 +13,7 @@
 #include "impl/daw_json_link_types_fwd.h"
 #include "impl/daw_json_parse_class.h"
 #include "impl/daw_json_value.h"
+#include "impl/daw_not_const_ex_functions.h"
 
 #include <daw/daw_cxmath.h>
 #include <daw/daw_move.h>
@@ -28,6 +29,7 @@
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <vector>
 
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
@@ -36,8 +38,10 @@ namespace daw::json {
 		/// heterogeneous, a basic_json_value_iterator may be more appropriate
 		template<typename JsonElement = json_value, auto... PolicyFlags>
 		class json_lines_iterator {
-			using ParseState = TryDefaultParsePolicy<BasicParsePolicy<
-			  options::details::make_parse_flags<PolicyFlags...>( ).value>>;
+			using ParseState =
+			  json_details::no_insitu_strings_policy_t<TryDefaultParsePolicy<
+			    BasicParsePolicy<options::details::make_parse_flags<PolicyFlags...>( )
+			                       .value>>>;
 			using CharT = typename ParseState::CharT;
 
 		public:
@@ -165,8 +169,10 @@ namespace daw::json {
 		/// @tparam ParsePolicy parsing policy type
 		template<typename JsonElement = json_value, auto... PolicyFlags>
 		struct json_lines_range {
-			using ParsePolicy = TryDefaultParsePolicy<BasicParsePolicy<
-			  options::details::make_parse_flags<PolicyFlags...>( ).value>>;
+			using ParsePolicy =
+			  json_details::no_insitu_strings_policy_t<TryDefaultParsePolicy<
+			    BasicParsePolicy<options::details::make_parse_flags<PolicyFlags...>( )
+			                       .value>>>;
 			using iterator = json_lines_iterator<JsonElement, PolicyFlags...>;
 			using CharT = typename ParsePolicy::CharT;
 
@@ -208,6 +214,23 @@ namespace daw::json {
 		                  json_lines_iterator<JsonElement, PolicyFlags...> )
 		  -> json_lines_range<JsonElement, PolicyFlags...>;
 
+		namespace json_details {
+			/// @brief Find the next newline in a jsonl document.  Strings cannot
+			/// hold a raw newline, so every newline ends a line.  Uses the SIMD
+			/// kernels of the exec mode when it has them and memchr otherwise
+			/// @return The position of the newline or last when there is none
+			template<typename ParseState>
+			char const *find_jsonl_newline( char const *first, char const *last ) {
+				if constexpr( has_wide_kernels_v<typename ParseState::exec_tag_t> ) {
+					return mem_move_to_next_of<false, '\n'>( ParseState::exec_tag, first,
+					                                         last );
+				} else {
+					return mem_move_to_next_of<false, '\n'>( runtime_exec_tag{ }, first,
+					                                         last );
+				}
+			}
+		} // namespace json_details
+
 		/// @brief parition the jsonl/nbjson document into num_partition non
 		/// overlapping sub-ranges. This can be used to parallelize json lines
 		/// parsing
@@ -230,9 +253,9 @@ namespace daw::json {
 					result.emplace_back( jsonl_doc );
 					break;
 				}
-				while( tmp < last and *tmp != '\n' ) {
-					++tmp;
-				}
+				using ParseState =
+				  typename json_lines_range<JsonElement, ParsePolicies...>::ParsePolicy;
+				tmp = json_details::find_jsonl_newline<ParseState>( tmp, last );
 				if( tmp < last ) {
 					++tmp;
 				}
@@ -450,6 +450,10 @@ namespace daw::json {
 				  json_details::get_bits_for<options::FPOutputFormat>( number_opts,
 				                                                       Options );
 
+				static constexpr options::FPFixedDecimals fp_fixed_decimals =
+				  json_details::get_bits_for<options::FPFixedDecimals>( number_opts,
+				                                                        Options );
+
 				static constexpr options::JsonNumberErrors allow_number_errors =
 				  json_details::get_bits_for<options::JsonNumberErrors>( number_opts,
 				                                                         Options );
@@ -0,0 +1,380 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_from_json.h"
+#include "daw_to_json.h"
+#include "impl/daw_json_work_stealing.h"
+
+#include <daw/daw_move.h>
+#include <daw/daw_traits.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		struct parallel_json_array_options {
+			/// The number of threads to parse or serialize with, 0 uses
+			/// std::thread::hardware_concurrency( )
+			std::size_t thread_count = 0;
+			/// The number of elements in each task, 0 gives each thread about
+			/// eight tasks so that work stealing can balance uneven elements
+			std::size_t elements_per_task = 0;
+		};
+
+		namespace json_details {
+			/// @brief Elements can be parsed straight into a pre-sized vector.
+			/// std::vector<bool> packs its elements, so threads cannot write them
+			/// independently
+			template<typename T>
+			inline constexpr bool can_parse_into_slot_v =
+			  std::is_default_constructible_v<T> and
+			  std::is_move_assignable_v<T> and not std::is_same_v<T, bool>;
+
+			/// @brief The number of elements in each task of a parallel array
+			/// parse or serialization
+			inline std::size_t
+			parallel_elements_per_task( parallel_json_array_options const &opts,
+			                            std::size_t thread_count,
+			                            std::size_t element_count ) {
+				if( opts.elements_per_task != 0 ) {
+					return opts.elements_per_task;
+				}
+				return ( std::max )( std::size_t{ 1 },
+				                     element_count / ( thread_count * 8U ) );
+			}
+
+			/// @brief The first element, in document order, that failed to parse
+			/// or serialize
+			struct parallel_array_error {
+				std::mutex mutex{ };
+				std::atomic<std::size_t> index = static_cast<std::size_t>( -1 );
+				std::exception_ptr error{ };
+
+				[[nodiscard]] bool is_before( std::size_t element_index ) const {
+					return index.load( std::memory_order_relaxed ) < element_index;
+				}
+
+				void set( std::size_t element_index, std::exception_ptr ex ) {
+					auto const lck = std::lock_guard<std::mutex>( mutex );
+					if( element_index < index.load( std::memory_order_relaxed ) ) {
+						index.store( element_index, std::memory_order_relaxed );
+						error = ex;
+					}
+				}
+			};
+		} // namespace json_details
+
+		/***
+		 * Parse JSON data where the root item is an array, on many threads.  A
+		 * first pass skips over each element to find where it starts, using the
+		 * structural index when the policy has one.  The elements are then
+		 * divided among a work stealing pool and each is parsed into its own slot
+		 * of a pre-sized std::vector.  The result and any error are the same as
+		 * from_json_array; when several elements are invalid the error is for the
+		 * first of them.
+		 * @tparam JsonElement The type of each element in array.  Must be one of
+		 * the above json_XXX classes.  This version is checked
+		 * @param json_data JSON string data containing array
+		 * @param opts The thread count and the number of elements in each task
+		 * @return A std::vector containing parsed data from JSON string
+		 * @throws daw::json::json_exception
+		 */
+		template<typename JsonElement, typename String, auto... PolicyFlags>
+		[[nodiscard]] std::vector<json_details::from_json_result_t<JsonElement>>
+		from_json_array_parallel( String &&json_data,
+		                          parallel_json_array_options const &opts,
+		                          options::parse_flags_t<PolicyFlags...> ) {
+			static_assert(
+			  json_details::is_string_view_like_v<String>,
+			  "String type must have a be a contiguous range of Characters" );
+
+			daw_json_ensure( std::size( json_data ) != 0,
+			                 ErrorReason::EmptyJSONDocument );
+			daw_json_ensure( std::data( json_data ) != nullptr,
+			                 ErrorReason::EmptyJSONPath );
+			static_assert(
+			  json_details::has_unnamed_default_type_mapping_v<JsonElement>,
+			  "Missing specialization of daw::json::json_data_contract for class "
+			  "mapping or specialization of daw::json::json_link_basic_type_map" );
+			using element_type = json_details::json_deduced_type<JsonElement>;
+			static_assert( not std::is_same_v<element_type, void>,
+			               "Unknown JsonElement type." );
+			using value_type = json_details::json_result_t<element_type>;
+
+			using ParsePolicy = json_details::no_insitu_strings_policy_t<
+			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>>;
+			using policy_zstring_t = json_details::apply_zstring_policy_option_t<
+			  ParsePolicy, String, options::ZeroTerminatedString::yes>;
+			using ParseState =
+			  daw::conditional_t<policy_zstring_t::is_default_parse_policy,
+			                     DefaultParsePolicy, policy_zstring_t>;
+
+			auto parse_state =
+			  ParseState{ std::data( json_data ), daw::data_end( json_data ) };
+			auto const structural_index =
+			  json_details::make_structural_index<ParseState>( parse_state.first,
+			                                                   parse_state.last );
+			parse_state.set_structural_index( structural_index );
+
+			parse_state.trim_left_unchecked( );
+			daw_json_ensure( parse_state.is_opening_bracket_checked( ),
+			                 ErrorReason::InvalidArrayStart, parse_state );
+			parse_state.remove_prefix( );
+			parse_state.trim_left_unchecked( );
+			auto const element_state = parse_state;
+
+			// Stage one, find where each element starts.  An error here is held
+			// until the elements before it are parsed, as the serial parse would
+			// report an invalid element first
+			auto starts = std::vector<typename ParseState::CharT *>( );
+#if defined( DAW_USE_EXCEPTIONS )
+			std::exception_ptr scan_error{ };
+			try {
+#endif
+				daw_json_assert_weak( parse_state.has_more( ),
+				                      ErrorReason::UnexpectedEndOfData, parse_state );
+				if( parse_state.front( ) != ']' ) {
+					while( true ) {
+						starts.push_back( parse_state.first );
+						(void)json_details::skip_value( parse_state );
+						parse_state.trim_left( );
+						daw_json_assert_weak( parse_state.has_more( ) and
+						                        parse_state.is_at_next_array_element( ),
+						                      ErrorReason::UnexpectedEndOfData,
+						                      parse_state );
+						parse_state.move_next_member_or_end( );
+						daw_json_assert_weak( parse_state.has_more( ),
+						                      ErrorReason::UnexpectedEndOfData,
+						                      parse_state );
+						if( parse_state.front( ) == ']' ) {
+							break;
+						}
+					}
+				}
+				parse_state.remove_prefix( );
+				parse_state.trim_left_checked( );
+				if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
+					daw_json_ensure( parse_state.empty( ),
+					                 ErrorReason::InvalidEndOfValue, parse_state );
+				}
+#if defined( DAW_USE_EXCEPTIONS )
+			} catch( ... ) { scan_error = std::current_exception( ); }
+#endif
+
+			// Stage two, parse the elements on the pool
+			std::size_t const element_count = starts.size( );
+			std::size_t const thread_count =
+			  opts.thread_count == 0 ? json_details::default_thread_count( )
+			                         : opts.thread_count;
+			std::size_t const elements_per_task =
+			  json_details::parallel_elements_per_task( opts, thread_count,
+			                                            element_count );
+			std::size_t const task_count =
+			  ( element_count + elements_per_task - 1U ) / elements_per_task;
+
+			auto parse_element = [&]( std::size_t index ) {
+				auto state = element_state;
+				state.first = starts[index];
+				return json_details::parse_value<element_type, false,
+				                                 element_type::expected_type>( state );
+			};
+			using slot_t =
+			  daw::conditional_t<json_details::can_parse_into_slot_v<value_type>,
+			                     value_type, std::optional<value_type>>;
+			auto slots = std::vector<slot_t>( element_count );
+			json_details::parallel_array_error first_error{ };
+			json_details::run_work_stealing(
+			  thread_count, task_count, [&]( std::size_t, std::size_t task_index ) {
+				  std::size_t const first = task_index * elements_per_task;
+				  std::size_t const last =
+				    ( std::min )( first + elements_per_task, element_count );
+				  for( std::size_t index = first; index < last; ++index ) {
+					  if( first_error.is_before( index ) ) {
+						  return;
+					  }
+#if defined( DAW_USE_EXCEPTIONS )
+					  try {
+#endif
+						  slots[index] = parse_element( index );
+#if defined( DAW_USE_EXCEPTIONS )
+					  } catch( ... ) {
+						  first_error.set( index, std::current_exception( ) );
+						  return;
+					  }
+#endif
+				  }
+			  } );
+#if defined( DAW_USE_EXCEPTIONS )
+			if( first_error.error ) {
+				std::rethrow_exception( first_error.error );
+			}
+			if( scan_error ) {
+				std::rethrow_exception( scan_error );
+			}
+#endif
+			if constexpr( json_details::can_parse_into_slot_v<value_type> ) {
+				return slots;
+			} else {
+				auto result = std::vector<value_type>( );
+				result.reserve( element_count );
+				for( auto &slot : slots ) {
+					result.push_back( std::move( *slot ) );
+				}
+				return result;
+			}
+		}
+
+		/// @brief Parse JSON data where the root item is an array, on many
+		/// threads
+		/// @tparam JsonElement The type of each element in array.  Must be one of
+		/// the above json_XXX classes.  This version is checked
+		/// @param json_data JSON string data containing array
+		/// @param opts The thread count and the number of elements in each task
+		/// @return A std::vector containing parsed data from JSON string
+		/// @throws daw::json::json_exception
+		template<typename JsonElement, typename String>
+		[[nodiscard]] std::vector<json_details::from_json_result_t<JsonElement>>
+		from_json_array_parallel( String &&json_data,
+		                          parallel_json_array_options const &opts =
+		                            parallel_json_array_options{ } ) {
+			return from_json_array_parallel<JsonElement>( DAW_FWD( json_data ), opts,
+			                                              options::parse_flags<> );
+		}
+
+		/***
+		 * Serialize the elements of a container as a JSON array on many threads.
+		 * The elements are divided into tasks on a work stealing pool, each task
+		 * serializes its elements into its own buffer, and the buffers are then
+		 * joined in order.  The output is the same as from to_json_array,
+		 * including the formatted output, and when several elements fail to
+		 * serialize the error is for the first of them.
+		 * @tparam JsonElement The mapping of the elements.  Defaults to deducing
+		 * it from them
+		 * @param c Container with random access iterators holding the elements
+		 * @param opts The thread count and the number of elements in each task
+		 * @return A std::string containing the JSON array
+		 */
+		template<typename JsonElement = use_default, typename Container,
+		         auto... PolicyFlags>
+		[[nodiscard]] std::string
+		to_json_array_parallel( Container const &c,
+		                        parallel_json_array_options const &opts =
+		                          parallel_json_array_options{ },
+		                        options::output_flags_t<PolicyFlags...> =
+		                          options::output_flags<> ) {
+			static_assert(
+			  daw::traits::is_container_like_v<daw::remove_cvref_t<Container>>,
+			  "Supplied container must support begin( )/end( )" );
+			using iterator_t = DAW_TYPEOF( std::begin( c ) );
+			static_assert(
+			  std::is_base_of_v<
+			    std::random_access_iterator_tag,
+			    typename std::iterator_traits<iterator_t>::iterator_category>,
+			  "Tasks start part way into the container, so it must have random "
+			  "access iterators" );
+			using policy_t =
+			  serialization_policy<std::string,
+			                       options::output_flags_t<PolicyFlags...>::value>;
+
+			auto const first_element = std::begin( c );
+			auto const element_count = static_cast<std::size_t>(
+			  std::distance( first_element, std::end( c ) ) );
+			std::size_t const thread_count =
+			  opts.thread_count == 0 ? json_details::default_thread_count( )
+			                         : opts.thread_count;
+			std::size_t const elements_per_task =
+			  json_details::parallel_elements_per_task( opts, thread_count,
+			                                            element_count );
+			std::size_t const task_count =
+			  ( element_count + elements_per_task - 1U ) / elements_per_task;
+
+			// Each task writes what to_json_array would between the brackets for
+			// its elements, so joining them in order gives the same output
+			auto chunks = std::vector<std::string>( task_count );
+			json_details::parallel_array_error first_error{ };
+			json_details::run_work_stealing(
+			  thread_count, task_count, [&]( std::size_t, std::size_t task_index ) {
+				  std::size_t const first = task_index * elements_per_task;
+				  std::size_t const last =
+				    ( std::min )( first + elements_per_task, element_count );
+				  auto out_it = policy_t( chunks[task_index] );
+				  out_it.add_indent( );
+				  for( std::size_t index = first; index < last; ++index ) {
+					  if( first_error.is_before( index ) ) {
+						  return;
+					  }
+#if defined( DAW_USE_EXCEPTIONS )
+					  try {
+#endif
+						  (void)[&out_it]( auto &&v ) {
+							  using v_type = DAW_TYPEOF( v );
+							  using JsonMember = typename daw::conditional_t<
+							    std::is_same_v<JsonElement, use_default>,
+							    json_details::ident_trait<json_details::json_deduced_type,
+							                              v_type>,
+							    json_details::ident_trait<json_details::json_deduced_type,
+							                              JsonElement>>::type;
+							  static_assert(
+							    not std::is_same_v<
+							      JsonMember,
+							      missing_json_data_contract_for_or_unknown_type<
+							        JsonElement>>,
+							    "Unable to detect unnamed mapping" );
+							  out_it.next_member( );
+							  out_it =
+							    json_details::member_to_string<JsonMember>( out_it, v );
+						  }
+						  ( first_element[static_cast<std::ptrdiff_t>( index )] );
+						  if( index + 1U < element_count ) {
+							  out_it.put( ',' );
+						  }
+#if defined( DAW_USE_EXCEPTIONS )
+					  } catch( ... ) {
+						  first_error.set( index, std::current_exception( ) );
+						  return;
+					  }
+#endif
+				  }
+			  } );
+#if defined( DAW_USE_EXCEPTIONS )
+			if( first_error.error ) {
+				std::rethrow_exception( first_error.error );
+			}
+#endif
+			std::size_t result_size = 2U + policy_t::newline.size( );
+			for( auto const &chunk : chunks ) {
+				result_size += chunk.size( );
+			}
+			std::string result{ };
+			result.reserve( result_size );
+			auto out_it = policy_t( result );
+			out_it.put( '[' );
+			for( auto const &chunk : chunks ) {
+				out_it.write( chunk );
+			}
+			if( element_count > 0 ) {
+				out_it.output_newline( );
+			}
+			out_it.put( ']' );
+			return result;
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -0,0 +1,235 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_json_lines_iterator.h"
+#include "impl/daw_json_work_stealing.h"
+
+#include <daw/daw_string_view.h>
+#include <daw/daw_traits.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		struct parallel_json_lines_options {
+			/// The number of threads to parse with, 0 uses
+			/// std::thread::hardware_concurrency( )
+			std::size_t thread_count = 0;
+			/// The approximate size in bytes of each chunk of lines.  A chunk is
+			/// extended to the end of the line it stops in.  Smaller chunks balance
+			/// better between threads, larger ones have less overhead
+			std::size_t chunk_size = 128U * 1024U;
+		};
+
+		namespace json_details {
+			/// @brief Split a jsonl document into chunks of whole lines, each about
+			/// chunk_size bytes.  Chunks holding only whitespace are dropped
+			template<typename ParseState>
+			std::vector<daw::string_view>
+			split_jsonl_chunks( daw::string_view jsonl_doc, std::size_t chunk_size ) {
+				if( chunk_size == 0 ) {
+					chunk_size = 1;
+				}
+				auto result = std::vector<daw::string_view>( );
+				result.reserve( jsonl_doc.size( ) / chunk_size + 1U );
+				char const *first = std::data( jsonl_doc );
+				char const *const last = daw::data_end( jsonl_doc );
+				while( first < last ) {
+					char const *pos = last;
+					if( static_cast<std::size_t>( last - first ) > chunk_size ) {
+						pos = find_jsonl_newline<ParseState>( first + chunk_size, last );
+						if( pos < last ) {
+							++pos;
+						}
+					}
+					auto chunk =
+					  daw::string_view( first, static_cast<std::size_t>( pos - first ) );
+					chunk.trim_suffix( );
+					if( not chunk.empty( ) ) {
+						result.push_back( chunk );
+					}
+					first = pos;
+				}
+				return result;
+			}
+
+			/// @brief Keep the per thread states on their own cache lines
+			template<typename State>
+			struct alignas( 64 ) parallel_lines_state {
+				State value;
+			};
+		} // namespace json_details
+
+		/***
+		 * Parse a JSON Lines document on many threads.  The document is split
+		 * into many small chunks of whole lines and the chunks are run on a work
+		 * stealing pool, so a few long lines or a slow callback do not leave
+		 * threads idle.  The threads are started for each call and joined before
+		 * it returns.  If parsing a line or a callback throws, the first exception
+		 * is rethrown once the other threads stop.
+		 * @tparam JsonElement The type of each line
+		 * @tparam PolicyFlags Parse options for each line
+		 */
+		template<typename JsonElement = json_value, auto... PolicyFlags>
+		class parallel_json_lines {
+		public:
+			using range_t = json_lines_range<JsonElement, PolicyFlags...>;
+			using iterator = typename range_t::iterator;
+			using value_type = typename iterator::value_type;
+
+		private:
+			using ParseState = typename range_t::ParsePolicy;
+
+			std::vector<daw::string_view> m_chunks{ };
+			std::size_t m_thread_count = 1;
+
+			template<typename Task>
+			void run( Task &&task ) const {
+				json_details::run_work_stealing( m_thread_count, m_chunks.size( ),
+				                                 task );
+			}
+
+		public:
+			explicit parallel_json_lines( daw::string_view jsonl_doc,
+			                              parallel_json_lines_options const &opts =
+			                                parallel_json_lines_options{ } )
+			  : m_chunks( json_details::split_jsonl_chunks<ParseState>(
+			      jsonl_doc, opts.chunk_size ) )
+			  , m_thread_count( opts.thread_count == 0
+			                      ? json_details::default_thread_count( )
+			                      : opts.thread_count ) {}
+
+			/// @return The number of chunks the document was split into
+			[[nodiscard]] std::size_t chunk_count( ) const {
+				return m_chunks.size( );
+			}
+
+			/// @return The lines of the chunk at index
+			[[nodiscard]] range_t chunk( std::size_t index ) const {
+				return range_t( m_chunks[index] );
+			}
+
+			/// @return The number of threads that will run, never more than the
+			/// number of chunks
+			[[nodiscard]] std::size_t thread_count( ) const {
+				return ( std::max )( std::size_t{ 1 },
+				                     ( std::min )( m_thread_count, m_chunks.size( ) ) );
+			}
+
+			/// @brief Call func( value ) for each line, from many threads at once
+			/// and in no particular order
+			template<typename Function>
+			void for_each( Function &&func ) const {
+				run( [&]( std::size_t, std::size_t index ) {
+					for( auto &&value : chunk( index ) ) {
+						func( std::move( value ) );
+					}
+				} );
+			}
+
+			/// @brief Call func( state, value ) for each line in no particular
+			/// order.  Each thread has its own state, made by make_state( ), so
+			/// func needs no synchronization
+			/// @return The state of each thread
+			template<typename MakeState, typename Function>
+			[[nodiscard]] auto for_each_with_state( MakeState &&make_state,
+			                                        Function &&func ) const {
+				using state_t = daw::remove_cvref_t<std::invoke_result_t<MakeState &>>;
+				auto states =
+				  std::vector<json_details::parallel_lines_state<state_t>>( );
+				states.reserve( thread_count( ) );
+				for( std::size_t n = 0; n < thread_count( ); ++n ) {
+					states.push_back( { make_state( ) } );
+				}
+				run( [&]( std::size_t worker_index, std::size_t index ) {
+					auto &state = states[worker_index].value;
+					for( auto &&value : chunk( index ) ) {
+						func( state, std::move( value ) );
+					}
+				} );
+				auto result = std::vector<state_t>( );
+				result.reserve( states.size( ) );
+				for( auto &state : states ) {
+					result.push_back( std::move( state.value ) );
+				}
+				return result;
+			}
+
+			/// @brief Fold the lines in document order.  Each line is passed to
+			/// map and the results are combined with combine, first within each
+			/// chunk and then across the chunks in order starting from init.
+			/// combine must be associative but need not be commutative
+			template<typename T, typename Map, typename Reduce>
+			[[nodiscard]] T reduce( T init, Map &&map, Reduce &&combine ) const {
+				auto partials = std::vector<std::optional<T>>( m_chunks.size( ) );
+				run( [&]( std::size_t, std::size_t index ) {
+					auto partial = std::optional<T>( );
+					for( auto &&value : chunk( index ) ) {
+						if( partial ) {
+							partial =
+							  combine( std::move( *partial ), map( std::move( value ) ) );
+						} else {
+							partial.emplace( map( std::move( value ) ) );
+						}
+					}
+					partials[index] = std::move( partial );
+				} );
+				for( auto &partial : partials ) {
+					if( partial ) {
+						init = combine( std::move( init ), std::move( *partial ) );
+					}
+				}
+				return init;
+			}
+
+			/// @brief Pass each line to map and collect the results in document
+			/// order
+			template<typename Map>
+			[[nodiscard]] auto collect( Map &&map ) const {
+				using result_t =
+				  daw::remove_cvref_t<std::invoke_result_t<Map &, value_type>>;
+				auto parts = std::vector<std::vector<result_t>>( m_chunks.size( ) );
+				run( [&]( std::size_t, std::size_t index ) {
+					auto part = std::vector<result_t>( );
+					for( auto &&value : chunk( index ) ) {
+						part.push_back( map( std::move( value ) ) );
+					}
+					parts[index] = std::move( part );
+				} );
+				std::size_t total = 0;
+				for( auto const &part : parts ) {
+					total += part.size( );
+				}
+				auto result = std::vector<result_t>( );
+				result.reserve( total );
+				for( auto &part : parts ) {
+					std::move( part.begin( ), part.end( ),
+					           std::back_inserter( result ) );
+				}
+				return result;
+			}
+
+			/// @brief Parse every line and return them in document order
+			[[nodiscard]] std::vector<value_type> collect( ) const {
+				return collect( []( value_type &&value ) -> value_type {
+					return std::move( value );
+				} );
+			}
+		};
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -30,8 +30,20 @@ namespace daw::json {
 					/// methods
 					runtime,
 					/// @brief *testing* Allow code paths that use SIMD intrinsics
-					simd
-				}; // 2bits
+					simd,
+					/// @brief *testing* Allow code paths that use 32 byte AVX2
+					/// intrinsics.  Requires DAW_ALLOW_AVX2, otherwise it is the same
+					/// as simd
+					avx2,
+					/// @brief *testing* Allow code paths that use 64 byte AVX512BW
+					/// intrinsics.  Requires DAW_ALLOW_AVX512, otherwise it is the same
+					/// as avx2
+					avx512,
+					/// @brief *testing* Select the SIMD code paths at runtime from the
+					/// instruction sets the CPU supports.  Requires
+					/// DAW_JSON_CPU_DISPATCH, otherwise it is the same as runtime
+					cpu_dispatch
+				}; // 3bits
 
 				///
 				/// @brief Input is a zero terminated string.  If this cannot be
@@ -91,9 +103,12 @@ namespace daw::json {
 
 				///
 				///@note Testing
-				///@brief Use precise IEEE754 parsing of real numbers.  The default is
-				/// no,
-				/// and results is much faster parsing with very small errors of 0-2ulp.
+				///@brief Use precise IEEE754 parsing of real numbers.  Float and double
+				/// are exact either way, except when more significant digits than fit
+				/// in 64 bits decide the rounding.  Then no rounds using the leading
+				/// digits, an error of at most 1ulp, and yes falls back to
+				/// strtod/from_chars.  Other types have very small errors of 0-2ulp
+				/// with no.
 				///
 				/// default: no
 				///
@@ -152,6 +167,32 @@ namespace daw::json {
 				/// default: no
 				///
 				enum class ExcludeSpecialEscapes : unsigned { no, yes }; // 1bit
+
+				///
+				/// @brief *testing* Run a vectorized first pass over the whole
+				/// document that records where each array and class ends.  Skipping
+				/// unmapped members, or members looked up out of order, then jumps
+				/// over them instead of scanning their bytes again.  It helps most on
+				/// documents with large sections that are not mapped.  The SIMD
+				/// kernels of the ExecModeTypes are used for the first pass.
+				///
+				/// default: no
+				///
+				enum class UseStructuralIndex : unsigned { no, yes }; // 1bit
+
+				///
+				/// @brief Decode escaped strings in place, writing them back into the
+				/// document buffer.  String members of std::string_view or
+				/// daw::string_view then refer to the decoded bytes, so escaped
+				/// strings are parsed without allocating.  Other string types leave
+				/// the document unchanged.  The
+				/// document must be a mutable buffer, e.g. a std::string or a char
+				/// array.  The strings are overwritten by the parse, so the document
+				/// can only be parsed once.
+				///
+				/// default: no
+				///
+				enum class InSituStrings : unsigned { no, yes }; // 1bit
 			} // namespace parser_options
 		}   // namespace options
 	}     // namespace DAW_JSON_VER
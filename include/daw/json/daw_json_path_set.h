@@ -0,0 +1,375 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_from_json.h"
+#include "impl/daw_json_parse_name.h"
+#include "impl/daw_json_skip.h"
+#include "impl/daw_json_value.h"
+
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <initializer_list>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			/// @brief A member name or array index of a json_path_set.  Paths
+			/// that share a prefix share its nodes
+			struct path_trie_node {
+				static constexpr std::size_t npos = static_cast<std::size_t>( -1 );
+
+				/// The member name as written in the path, with its escapes
+				daw::string_view name{ };
+				std::size_t array_index = 0;
+				std::size_t first_child = npos;
+				std::size_t next_sibling = npos;
+				bool is_index = false;
+				/// A path ends at this node
+				bool is_terminal = false;
+			};
+		} // namespace json_details
+
+		/***
+		 * A set of JSON paths, in the dot and bracket form of from_json's
+		 * member_path, e.g. "user.name" or "items[3].id".  The paths are merged
+		 * into a trie so that find_json_paths and from_json_paths find all of
+		 * them in one pass over the document.  Build the set once and reuse it
+		 * for each document.  The path strings must outlive the set.
+		 */
+		class json_path_set {
+			using node_t = json_details::path_trie_node;
+
+			std::vector<node_t> m_nodes = std::vector<node_t>( 1 );
+			std::vector<std::size_t> m_path_nodes{ };
+			std::size_t m_terminal_count = 0;
+
+			[[nodiscard]] std::size_t find_or_add_child( std::size_t parent,
+			                                             daw::string_view name,
+			                                             bool is_index ) {
+				auto const array_index =
+				  is_index ? json_details::parse_unsigned_int<std::size_t>(
+				               name.data( ), name.data_end( ) )
+				           : std::size_t{ 0 };
+				std::size_t *link = &m_nodes[parent].first_child;
+				while( *link != node_t::npos ) {
+					auto const &child = m_nodes[*link];
+					if( child.is_index == is_index and
+					    ( is_index ? child.array_index == array_index
+					               : child.name == name ) ) {
+						return *link;
+					}
+					link = &m_nodes[*link].next_sibling;
+				}
+				auto const result = m_nodes.size( );
+				*link = result;
+				auto node = node_t{ };
+				node.name = name;
+				node.array_index = array_index;
+				node.is_index = is_index;
+				m_nodes.push_back( node );
+				return result;
+			}
+
+		public:
+			json_path_set( ) = default;
+
+			json_path_set( std::initializer_list<std::string_view> paths ) {
+				for( auto path : paths ) {
+					(void)add( path );
+				}
+			}
+
+			template<typename Container,
+			         std::enable_if_t<not std::is_convertible_v<Container const &,
+			                                                    std::string_view>,
+			                          std::nullptr_t> = nullptr>
+			explicit json_path_set( Container const &paths ) {
+				for( auto const &path : paths ) {
+					(void)add( std::string_view( path ) );
+				}
+			}
+
+			/// @brief Add a path to the set.  An empty path is the whole document
+			/// @return The index of the path's result
+			std::size_t add( std::string_view path ) {
+				auto remaining = daw::string_view( path );
+				std::size_t node = 0;
+				auto item = json_details::pop_json_path( remaining );
+				while( not item.current.empty( ) or not remaining.empty( ) ) {
+					// An index that is first or follows another index starts with
+					// an empty item
+					if( not item.current.empty( ) ) {
+						node = find_or_add_child( node, item.current,
+						                          item.found_char == ']' );
+					}
+					item = json_details::pop_json_path( remaining );
+				}
+				if( not m_nodes[node].is_terminal ) {
+					m_nodes[node].is_terminal = true;
+					++m_terminal_count;
+				}
+				m_path_nodes.push_back( node );
+				return m_path_nodes.size( ) - 1U;
+			}
+
+			/// @return The number of paths added
+			[[nodiscard]] std::size_t size( ) const {
+				return m_path_nodes.size( );
+			}
+
+			/// @brief The trie of the paths.  Should not be used as part of public
+			/// API
+			[[nodiscard]] std::vector<node_t> const &nodes( ) const {
+				return m_nodes;
+			}
+
+			/// @brief The trie node where each path ends.  Should not be used as
+			/// part of public API
+			[[nodiscard]] std::vector<std::size_t> const &path_nodes( ) const {
+				return m_path_nodes;
+			}
+
+			/// @brief The number of distinct paths.  Should not be used as part of
+			/// public API
+			[[nodiscard]] std::size_t terminal_count( ) const {
+				return m_terminal_count;
+			}
+		};
+
+		namespace json_details {
+			/// @brief Record where the paths under node start in the value at
+			/// parse_state, skipping the members and elements that no path goes
+			/// through.  parse_state is left after the value
+			/// @return false once every path has been found, the rest of the
+			/// document is not read
+			template<typename ParseState>
+			bool find_json_path_positions( ParseState &parse_state,
+			                               path_trie_node const *nodes,
+			                               std::size_t node, char const **found,
+			                               std::size_t &remaining ) {
+				parse_state.trim_left( );
+				daw_json_assert_weak( parse_state.has_more( ),
+				                      ErrorReason::UnexpectedEndOfData, parse_state );
+				auto const &current = nodes[node];
+				if( current.is_terminal and found[node] == nullptr ) {
+					found[node] = parse_state.first;
+					if( --remaining == 0 ) {
+						return false;
+					}
+				}
+				if( current.first_child == path_trie_node::npos or
+				    ( parse_state.front( ) != '{' and parse_state.front( ) != '[' ) ) {
+					(void)skip_value( parse_state );
+					return true;
+				}
+				bool const is_class = parse_state.front( ) == '{';
+				char const close = is_class ? '}' : ']';
+				parse_state.remove_prefix( );
+				parse_state.trim_left( );
+				std::size_t element_index = 0;
+				while( parse_state.has_more( ) and parse_state.front( ) != close ) {
+					std::size_t child = current.first_child;
+					if( is_class ) {
+						auto const name = parse_name( parse_state );
+						while( child != path_trie_node::npos and
+						       ( nodes[child].is_index or
+						         not json_path_compare( nodes[child].name, name ) ) ) {
+							child = nodes[child].next_sibling;
+						}
+					} else {
+						while( child != path_trie_node::npos and
+						       ( not nodes[child].is_index or
+						         nodes[child].array_index != element_index ) ) {
+							child = nodes[child].next_sibling;
+						}
+						++element_index;
+					}
+					if( child == path_trie_node::npos ) {
+						(void)skip_value( parse_state );
+					} else if( not find_json_path_positions( parse_state, nodes, child,
+					                                         found, remaining ) ) {
+						return false;
+					}
+					parse_state.move_next_member_or_end( );
+				}
+				daw_json_assert_weak( parse_state.has_more( ),
+				                      ErrorReason::UnexpectedEndOfData, parse_state );
+				parse_state.remove_prefix( );
+				return true;
+			}
+
+			/// @return Where each node of paths that ends a path starts in the
+			/// document, or nullptr when it is not in it
+			template<typename ParseState>
+			std::vector<char const *>
+			find_json_path_positions( ParseState parse_state,
+			                          json_path_set const &paths ) {
+				auto const &nodes = paths.nodes( );
+				auto found = std::vector<char const *>( nodes.size( ), nullptr );
+				std::size_t remaining = paths.terminal_count( );
+				if( remaining > 0 ) {
+					(void)find_json_path_positions( parse_state, nodes.data( ), 0,
+					                                found.data( ), remaining );
+				}
+				return found;
+			}
+
+			template<typename JsonMember, typename ParseState>
+			[[nodiscard]] auto parse_json_path_value( ParseState parse_state,
+			                                          char const *first ) {
+				using json_member = json_deduced_type<JsonMember>;
+				if constexpr( is_json_nullable_v<json_member> ) {
+					if( first == nullptr ) {
+						return construct_nullable_empty<
+						  json_constructor_t<json_member>>( );
+					}
+				} else {
+					daw_json_ensure( first != nullptr, ErrorReason::JSONPathNotFound );
+				}
+				parse_state.first = first;
+				return parse_value<json_member, false, json_member::expected_type>(
+				  parse_state );
+			}
+
+			template<typename... JsonMembers, typename ParseState,
+			         std::size_t... Is>
+			[[nodiscard]] std::tuple<from_json_result_t<JsonMembers>...>
+			parse_json_path_values( ParseState const &parse_state,
+			                        json_path_set const &paths,
+			                        std::vector<char const *> const &found,
+			                        std::index_sequence<Is...> ) {
+				auto const &path_nodes = paths.path_nodes( );
+				// Braced initialization parses the values in order
+				return std::tuple<from_json_result_t<JsonMembers>...>{
+				  parse_json_path_value<JsonMembers>( parse_state,
+				                                      found[path_nodes[Is]] )... };
+			}
+
+			/// @brief Paths can overlap, so a string may be read by more than one
+			template<typename String, auto... PolicyFlags>
+			using json_path_policy_t =
+			  no_insitu_strings_policy_t<apply_zstring_policy_option_t<
+			    BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>,
+			    String, options::ZeroTerminatedString::yes>>;
+
+			/// @brief The ParseState from_json uses for a document of type String
+			template<typename String, auto... PolicyFlags>
+			using json_path_parse_state_t = daw::conditional_t<
+			  json_path_policy_t<String, PolicyFlags...>::is_default_parse_policy,
+			  DefaultParsePolicy, json_path_policy_t<String, PolicyFlags...>>;
+		} // namespace json_details
+
+		/***
+		 * Find the values of all the paths in one pass over the document.
+		 * Members and elements that no path goes through are skipped, and the
+		 * document is only read until the last path is found.
+		 * @param json_data JSON string data
+		 * @param paths The paths to find
+		 * @return A json_value for each path, in the order they were added, or
+		 * an empty one when the path is not in the document.  They refer to
+		 * json_data
+		 */
+		template<typename String, auto... PolicyFlags>
+		[[nodiscard]] std::vector<
+		  basic_json_value<options::parse_flags_t<PolicyFlags...>::value>>
+		find_json_paths( String &&json_data, json_path_set const &paths,
+		                 options::parse_flags_t<PolicyFlags...> =
+		                   options::parse_flags<> ) {
+			static_assert(
+			  json_details::is_string_view_like_v<String>,
+			  "String type must have a be a contiguous range of Characters" );
+			daw_json_ensure( std::data( json_data ) != nullptr,
+			                 ErrorReason::EmptyJSONDocument );
+			daw_json_ensure( std::size( json_data ) != 0,
+			                 ErrorReason::EmptyJSONDocument );
+			using ParseState =
+			  json_details::json_path_parse_state_t<String, PolicyFlags...>;
+			using value_t =
+			  basic_json_value<options::parse_flags_t<PolicyFlags...>::value>;
+			char const *first = std::data( json_data );
+			char const *last = daw::data_end( json_data );
+			if( last[-1] == 0 ) {
+				--last;
+			}
+			auto parse_state = ParseState( first, last );
+			auto const structural_index =
+			  json_details::make_structural_index<ParseState>( first, last );
+			parse_state.set_structural_index( structural_index );
+
+			auto const found =
+			  json_details::find_json_path_positions( parse_state, paths );
+			auto result = std::vector<value_t>( );
+			result.reserve( paths.size( ) );
+			for( std::size_t node : paths.path_nodes( ) ) {
+				if( found[node] == nullptr ) {
+					result.emplace_back( );
+				} else {
+					result.emplace_back(
+					  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>(
+					    found[node], last ) );
+				}
+			}
+			return result;
+		}
+
+		/***
+		 * Parse the values of all the paths, found in one pass over the
+		 * document.  Members and elements that no path goes through are
+		 * skipped, and the document is only read until the last path is found.
+		 * @tparam JsonMembers The type of each path's value, in the order the
+		 * paths were added.  A path that is not in the document is an error
+		 * unless its type is nullable
+		 * @param json_data JSON string data
+		 * @param paths The paths to parse
+		 * @return A std::tuple of the values
+		 * @throws daw::json::json_exception
+		 */
+		template<typename... JsonMembers, typename String, auto... PolicyFlags>
+		[[nodiscard]] std::tuple<json_details::from_json_result_t<JsonMembers>...>
+		from_json_paths( String &&json_data, json_path_set const &paths,
+		                 options::parse_flags_t<PolicyFlags...> =
+		                   options::parse_flags<> ) {
+			static_assert(
+			  json_details::is_string_view_like_v<String>,
+			  "String type must have a be a contiguous range of Characters" );
+			static_assert( sizeof...( JsonMembers ) > 0,
+			               "A type is needed for each path" );
+			daw_json_ensure( std::data( json_data ) != nullptr,
+			                 ErrorReason::EmptyJSONDocument );
+			daw_json_ensure( std::size( json_data ) != 0,
+			                 ErrorReason::EmptyJSONDocument );
+			daw_json_ensure( paths.size( ) == sizeof...( JsonMembers ),
+			                 ErrorReason::InvalidJSONPath );
+			using ParseState =
+			  json_details::json_path_parse_state_t<String, PolicyFlags...>;
+			char const *first = std::data( json_data );
+			char const *last = daw::data_end( json_data );
+			if( last[-1] == 0 ) {
+				--last;
+			}
+			auto parse_state = ParseState( first, last );
+			auto const structural_index =
+			  json_details::make_structural_index<ParseState>( first, last );
+			parse_state.set_structural_index( structural_index );
+
+			auto const found =
+			  json_details::find_json_path_positions( parse_state, paths );
+			return json_details::parse_json_path_values<JsonMembers...>(
+			  parse_state, paths, found, std::index_sequence_for<JsonMembers...>{ } );
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
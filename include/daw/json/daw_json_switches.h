@@ -110,6 +110,52 @@
 
 // Allow experimental SIMD paths, if available
 // by defining DAW_ALLOW_SSE42 and using the parser policy ExecModeType simd
+// The wider kernels are enabled with DAW_ALLOW_AVX2 and DAW_ALLOW_AVX512(
+// requires AVX512BW) and selected with the ExecModeTypes avx2 and avx512.
+// Each implies the narrower instruction sets
+#if defined( DAW_ALLOW_AVX512 ) and not defined( DAW_ALLOW_AVX2 )
+#define DAW_ALLOW_AVX2
+#endif
+
+#if defined( DAW_ALLOW_AVX2 ) and not defined( DAW_ALLOW_SSE42 )
+#define DAW_ALLOW_SSE42
+#endif
+
+// Define DAW_JSON_CPU_DISPATCH to enable ExecModeTypes::cpu_dispatch.  The
+// SIMD kernels are compiled for each instruction set without needing compiler
+// flags like -mavx2, and the best one the CPU supports is selected on first
+// use.  Only x86-64 is supported
+#if defined( DAW_JSON_CPU_DISPATCH )
+#if not( defined( __x86_64__ ) or defined( _M_X64 ) )
+#error DAW_JSON_CPU_DISPATCH requires an x86-64 target
+#endif
+#if defined( __GNUC__ ) or defined( __clang__ )
+#define DAW_JSON_TARGET_SSE42 __attribute__( ( target( "sse4.2,pclmul" ) ) )
+#define DAW_JSON_TARGET_AVX2 __attribute__( ( target( "avx2,pclmul" ) ) )
+#define DAW_JSON_TARGET_AVX512 \
+	__attribute__( ( target( "avx512f,avx512bw,avx2,pclmul" ) ) )
+#endif
+#endif
+
+#if not defined( DAW_JSON_TARGET_SSE42 )
+#define DAW_JSON_TARGET_SSE42
+#define DAW_JSON_TARGET_AVX2
+#define DAW_JSON_TARGET_AVX512
+#endif
+
+// The SIMD kernels are needed when their exec mode is allowed or for runtime
+// dispatch
+#if defined( DAW_ALLOW_SSE42 ) or defined( DAW_JSON_CPU_DISPATCH )
+#define DAW_JSON_HAS_SSE42_KERNELS
+#endif
+
+#if defined( DAW_ALLOW_AVX2 ) or defined( DAW_JSON_CPU_DISPATCH )
+#define DAW_JSON_HAS_AVX2_KERNELS
+#endif
+
+#if defined( DAW_ALLOW_AVX512 ) or defined( DAW_JSON_CPU_DISPATCH )
+#define DAW_JSON_HAS_AVX512_KERNELS
+#endif
 
 // Use strtod instead of from_chars when avialable by defining
 // DAW_JSON_USE_STRTOD
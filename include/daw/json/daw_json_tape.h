@@ -0,0 +1,831 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_json_exception.h"
+#include "impl/daw_json_arrow_proxy.h"
+#include "impl/daw_json_assert.h"
+#include "impl/daw_json_parse_name.h"
+#include "impl/daw_json_parse_policy.h"
+#include "impl/daw_json_skip.h"
+#include "impl/daw_json_value.h"
+#include "impl/daw_murmur3.h"
+
+#include <daw/daw_data_end.h>
+#include <daw/daw_string_view.h>
+#include <daw/daw_uint_buffer.h>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			/// @brief The type of a value on a json tape
+			enum class tape_type : std::uint8_t {
+				Null,
+				True,
+				False,
+				Number,
+				String,
+				Class,
+				Array
+			};
+
+			[[nodiscard]] constexpr bool is_tape_container( tape_type type ) {
+				return type == tape_type::Class or type == tape_type::Array;
+			}
+
+			/***
+			 * A 64 bit entry of a json tape.  The top 3 bits are the tape_type,
+			 * the next 29 bits are the link, and the low 32 bits are the offset of
+			 * the value in the document.  The link of a class or array is the
+			 * number of entries to one past its end, and the link of a string or
+			 * number is the size of its text.  Member names are strings.
+			 *
+			 * A class or array entry is followed by one with the count of its
+			 * members/elements in the low 32 bits and, once it is built, the
+			 * position after its member index in the high 32 bits
+			 */
+			struct tape_entry {
+				std::uint64_t value = 0;
+
+				static constexpr std::uint64_t max_link = ( 1ULL << 29U ) - 1U;
+				static constexpr std::uint64_t max_offset = 0xFFFF'FFFFULL;
+
+				[[nodiscard]] static constexpr tape_entry
+				make( tape_type type, std::uint64_t link, std::uint64_t offset ) {
+					return tape_entry{ ( static_cast<std::uint64_t>( type ) << 61U ) |
+					                   ( link << 32U ) | offset };
+				}
+
+				[[nodiscard]] constexpr tape_type type( ) const {
+					return static_cast<tape_type>( value >> 61U );
+				}
+
+				[[nodiscard]] constexpr std::size_t link( ) const {
+					return static_cast<std::size_t>( ( value >> 32U ) & max_link );
+				}
+
+				[[nodiscard]] constexpr std::size_t offset( ) const {
+					return static_cast<std::size_t>( value & max_offset );
+				}
+
+				constexpr void set_link( std::uint64_t link ) {
+					value = ( value & ~( max_link << 32U ) ) | ( link << 32U );
+				}
+
+				[[nodiscard]] constexpr std::size_t count( ) const {
+					return static_cast<std::size_t>( value & max_offset );
+				}
+
+				[[nodiscard]] constexpr std::size_t index_last( ) const {
+					return static_cast<std::size_t>( value >> 32U );
+				}
+
+				constexpr void set_index_last( std::uint64_t pos ) {
+					value = ( value & max_offset ) | ( pos << 32U );
+				}
+			};
+
+			/// @brief A slot of the open addressed hash table of a class's members.
+			/// name_entry is the tape position of the member name, 0 when empty
+			struct tape_member_slot {
+				daw::UInt32 hash{ };
+				std::uint32_t name_entry = 0;
+			};
+
+			/// @brief Classes with fewer members are searched linearly instead of
+			/// building a member index
+			inline constexpr std::size_t tape_index_min_members = 8;
+		} // namespace json_details
+
+		template<json_options_t PolicyFlags = json_details::default_policy_flag>
+		class basic_json_tape;
+
+		template<json_options_t PolicyFlags = json_details::default_policy_flag>
+		class basic_json_tape_value;
+
+		template<json_options_t PolicyFlags = json_details::default_policy_flag>
+		class basic_json_tape_iterator;
+
+		/// @brief A name/value pair of a json tape class member or array element
+		template<json_options_t PolicyFlags = json_details::default_policy_flag>
+		struct basic_json_tape_pair {
+			std::optional<std::string_view> name;
+			basic_json_tape_value<PolicyFlags> value;
+		};
+
+		/***
+		 * A document parsed in one pass into a tape of 64 bit entries, one for
+		 * each value and member name.  Classes and arrays link to their end, so
+		 * moving to the next member or element is O(1) no matter how large the
+		 * current one is.  The members of a class are found with a hash index
+		 * that is built the first time the class is searched.  This suits code
+		 * that explores documents of unknown structure, where json_value would
+		 * reparse the document on each access.
+		 *
+		 * The tape refers to the document, which must outlive it, and the
+		 * basic_json_tape_value's refer to the tape.  Building the member
+		 * indices changes the tape, so a tape must not be searched from several
+		 * threads at once.  Documents are limited to 4GiB, strings to 512MiB.
+		 * @tparam PolicyFlags Parse policy flags.  See parser_policies.md
+		 */
+		template<json_options_t PolicyFlags>
+		class basic_json_tape {
+			friend class basic_json_tape_value<PolicyFlags>;
+			friend class basic_json_tape_iterator<PolicyFlags>;
+
+			using ParseState = json_details::no_insitu_strings_policy_t<
+			  TryDefaultParsePolicy<BasicParsePolicy<PolicyFlags>>>;
+			using tape_entry = json_details::tape_entry;
+			using tape_type = json_details::tape_type;
+
+			daw::string_view m_document{ };
+			// The member indices are built on the first search of a class
+			mutable std::vector<tape_entry> m_tape{ };
+			mutable std::vector<json_details::tape_member_slot> m_member_index{ };
+
+			static constexpr std::size_t npos = static_cast<std::size_t>( -1 );
+
+			void push( tape_type type, std::size_t link, char const *ptr ) {
+				daw_json_ensure( link <= tape_entry::max_link,
+				                 ErrorReason::DocumentTooLarge );
+				m_tape.push_back( tape_entry::make(
+				  type, link,
+				  static_cast<std::uint64_t>( ptr - std::data( m_document ) ) ) );
+			}
+
+			void push_name( ParseState &parse_state ) {
+				daw_json_assert_weak( parse_state.is_quotes_checked( ),
+				                      ErrorReason::MissingMemberNameOrEndOfClass,
+				                      parse_state );
+				auto const name = json_details::parse_name( parse_state );
+				push( tape_type::String, std::size( name ), std::data( name ) - 1 );
+			}
+
+			/// @brief Add the tape entry of the value at parse_state
+			/// @return true when the value is a class or array, which is left open
+			/// for its members/elements
+			[[nodiscard]] bool
+			push_value( ParseState &parse_state,
+			            std::vector<std::size_t> &open_containers ) {
+				daw_json_assert_weak( parse_state.has_more( ),
+				                      ErrorReason::UnexpectedEndOfData, parse_state );
+				auto const *const first = parse_state.first;
+				switch( parse_state.front( ) ) {
+				case '{':
+				case '[':
+					open_containers.push_back( std::size( m_tape ) );
+					push( parse_state.front( ) == '{' ? tape_type::Class
+					                                  : tape_type::Array,
+					      0, first );
+					m_tape.push_back( tape_entry{ } );
+					parse_state.remove_prefix( );
+					return true;
+				case '"': {
+					auto const str = json_details::skip_string( parse_state );
+					push( tape_type::String, std::size( str ), first );
+					return false;
+				}
+				case 't':
+					(void)json_details::skip_true( parse_state );
+					push( tape_type::True, 0, first );
+					return false;
+				case 'f':
+					(void)json_details::skip_false( parse_state );
+					push( tape_type::False, 0, first );
+					return false;
+				case 'n':
+					(void)json_details::skip_null( parse_state );
+					push( tape_type::Null, 0, first );
+					return false;
+				case '-':
+				case '0':
+				case '1':
+				case '2':
+				case '3':
+				case '4':
+				case '5':
+				case '6':
+				case '7':
+				case '8':
+				case '9': {
+					auto const number = json_details::skip_number( parse_state );
+					push( tape_type::Number, std::size( number ), first );
+					return false;
+				}
+				}
+				daw_json_error( ErrorReason::InvalidStartOfValue, parse_state );
+			}
+
+			/// @brief Count the value that was added to the innermost open class or
+			/// array, and close those that end at parse_state
+			/// @param has_new_value false when the innermost class or array was
+			/// just opened
+			/// @return true when the next value is a member/element of an open
+			/// class or array, false when the document is complete
+			[[nodiscard]] bool close_containers(
+			  ParseState &parse_state, std::vector<std::size_t> &open_containers,
+			  bool has_new_value ) {
+				while( not open_containers.empty( ) ) {
+					parse_state.trim_left( );
+					auto const container = open_containers.back( );
+					bool const is_class = m_tape[container].type( ) == tape_type::Class;
+					char const close_char = is_class ? '}' : ']';
+					if( has_new_value ) {
+						++m_tape[container + 1].value;
+						daw_json_assert_weak( parse_state.has_more( ),
+						                      ErrorReason::UnexpectedEndOfData,
+						                      parse_state );
+						if( parse_state.front( ) == ',' ) {
+							parse_state.remove_prefix( );
+							parse_state.trim_left( );
+							if( is_class ) {
+								push_name( parse_state );
+							}
+							return true;
+						}
+					} else if( parse_state.has_more( ) and
+					           parse_state.front( ) != close_char ) {
+						if( is_class ) {
+							push_name( parse_state );
+						}
+						return true;
+					}
+					daw_json_assert_weak( parse_state.has_more( ) and
+					                        parse_state.front( ) == close_char,
+					                      ErrorReason::InvalidBracketing, parse_state );
+					parse_state.remove_prefix( );
+					auto const link = std::size( m_tape ) - container;
+					daw_json_ensure( link <= tape_entry::max_link,
+					                 ErrorReason::DocumentTooLarge );
+					m_tape[container].set_link( link );
+					open_containers.pop_back( );
+					has_new_value = true;
+				}
+				parse_state.trim_left( );
+				return false;
+			}
+
+			void build( ) {
+				m_tape.clear( );
+				m_member_index.clear( );
+				daw_json_ensure( std::size( m_document ) <= tape_entry::max_offset,
+				                 ErrorReason::DocumentTooLarge );
+				auto parse_state =
+				  ParseState( std::data( m_document ), daw::data_end( m_document ) );
+				parse_state.trim_left( );
+				daw_json_ensure( parse_state.has_more( ),
+				                 ErrorReason::EmptyJSONDocument );
+				auto open_containers = std::vector<std::size_t>( );
+				bool is_opened = push_value( parse_state, open_containers );
+				while( close_containers( parse_state, open_containers,
+				                         not is_opened ) ) {
+					is_opened = push_value( parse_state, open_containers );
+				}
+				if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
+					daw_json_ensure( not parse_state.has_more( ),
+					                 ErrorReason::InvalidEndOfValue, parse_state );
+				}
+			}
+
+			/// @brief The position after the value at pos
+			[[nodiscard]] std::size_t next( std::size_t pos ) const {
+				auto const entry = m_tape[pos];
+				if( json_details::is_tape_container( entry.type( ) ) ) {
+					return pos + entry.link( );
+				}
+				return pos + 1;
+			}
+
+			[[nodiscard]] char const *text_at( std::size_t pos ) const {
+				return std::data( m_document ) + m_tape[pos].offset( );
+			}
+
+			/// @brief The member name at pos, as it is in the document
+			[[nodiscard]] daw::string_view name_at( std::size_t pos ) const {
+				return daw::string_view( text_at( pos ) + 1, m_tape[pos].link( ) );
+			}
+
+			[[nodiscard]] static daw::UInt32 hash_name( daw::string_view name ) {
+				return daw::name_hash<ParseState::expect_long_strings>( name );
+			}
+
+			/// @brief The index of a class is a power of 2 that is at least twice
+			/// the member count, so there is always an empty slot to end a search
+			[[nodiscard]] static std::size_t member_index_size( std::size_t count ) {
+				std::size_t result = 2;
+				while( result < count * 2 ) {
+					result *= 2;
+				}
+				return result;
+			}
+
+			/// @brief Build the member index of the class at pos
+			/// @return The position after the index in m_member_index
+			std::size_t build_member_index( std::size_t pos ) const {
+				auto const count = m_tape[pos + 1].count( );
+				auto const index_size = member_index_size( count );
+				auto const index_first = std::size( m_member_index );
+				m_member_index.resize( index_first + index_size );
+				auto *const slots = std::data( m_member_index ) + index_first;
+				auto name_pos = pos + 2;
+				for( std::size_t n = 0; n < count; ++n ) {
+					auto const name = name_at( name_pos );
+					auto const hash = hash_name( name );
+					auto slot = static_cast<std::size_t>( hash ) & ( index_size - 1 );
+					while( slots[slot].name_entry != 0 ) {
+						if( slots[slot].hash == hash and
+						    name_at( slots[slot].name_entry ) == name ) {
+							// Like json_value, the first member of a name is found
+							break;
+						}
+						slot = ( slot + 1 ) & ( index_size - 1 );
+					}
+					if( slots[slot].name_entry == 0 ) {
+						slots[slot] = json_details::tape_member_slot{
+						  hash, static_cast<std::uint32_t>( name_pos ) };
+					}
+					name_pos = next( name_pos + 1 );
+				}
+				auto const index_last = index_first + index_size;
+				m_tape[pos + 1].set_index_last( index_last );
+				return index_last;
+			}
+
+			/// @return The position of the value of the named member of the class
+			/// at pos or npos
+			[[nodiscard]] std::size_t
+			find_class_member( std::size_t pos, daw::string_view name ) const {
+				auto const count = m_tape[pos + 1].count( );
+				if( count < json_details::tape_index_min_members ) {
+					auto name_pos = pos + 2;
+					for( std::size_t n = 0; n < count; ++n ) {
+						if( name_at( name_pos ) == name ) {
+							return name_pos + 1;
+						}
+						name_pos = next( name_pos + 1 );
+					}
+					return npos;
+				}
+				auto index_last = m_tape[pos + 1].index_last( );
+				if( index_last == 0 ) {
+					index_last = build_member_index( pos );
+				}
+				auto const index_size = member_index_size( count );
+				auto const *const slots =
+				  std::data( m_member_index ) + ( index_last - index_size );
+				auto const hash = hash_name( name );
+				auto slot = static_cast<std::size_t>( hash ) & ( index_size - 1 );
+				while( slots[slot].name_entry != 0 ) {
+					if( slots[slot].hash == hash and
+					    name_at( slots[slot].name_entry ) == name ) {
+						return slots[slot].name_entry + 1U;
+					}
+					slot = ( slot + 1 ) & ( index_size - 1 );
+				}
+				return npos;
+			}
+
+			/// @return The position of the value of the member of the class at pos
+			/// matching a member path item, which can have escapes, or npos
+			[[nodiscard]] std::size_t
+			find_class_member_escaped( std::size_t pos,
+			                           daw::string_view name ) const {
+				auto const count = m_tape[pos + 1].count( );
+				auto name_pos = pos + 2;
+				for( std::size_t n = 0; n < count; ++n ) {
+					if( json_details::json_path_compare( name, name_at( name_pos ) ) ) {
+						return name_pos + 1;
+					}
+					name_pos = next( name_pos + 1 );
+				}
+				return npos;
+			}
+
+			/// @return The position of the nth value of the class or array at pos,
+			/// or npos
+			[[nodiscard]] std::size_t find_element( std::size_t pos,
+			                                        std::size_t index ) const {
+				if( index >= m_tape[pos + 1].count( ) ) {
+					return npos;
+				}
+				bool const is_class = m_tape[pos].type( ) == tape_type::Class;
+				auto value_pos = pos + 2 + static_cast<std::size_t>( is_class );
+				while( index > 0 ) {
+					--index;
+					value_pos = next( value_pos ) + static_cast<std::size_t>( is_class );
+				}
+				return value_pos;
+			}
+
+		public:
+			basic_json_tape( ) = default;
+
+			/// @brief Parse json_doc onto the tape
+			/// @param json_doc The JSON document.  It must outlive the tape
+			explicit basic_json_tape( daw::string_view json_doc )
+			  : m_document( json_doc ) {
+				build( );
+			}
+
+			/// @brief Parse another document, reusing the storage of the tape.
+			/// Values from the previous document are no longer valid
+			/// @param json_doc The JSON document.  It must outlive the tape
+			void parse( daw::string_view json_doc ) {
+				m_document = json_doc;
+				build( );
+			}
+
+			/// @return The value of the whole document, or an empty value if
+			/// nothing has been parsed
+			[[nodiscard]] basic_json_tape_value<PolicyFlags> root( ) const {
+				if( m_tape.empty( ) ) {
+					return basic_json_tape_value<PolicyFlags>( );
+				}
+				return basic_json_tape_value<PolicyFlags>( *this, 0 );
+			}
+
+			/// @return The number of entries on the tape
+			[[nodiscard]] std::size_t size( ) const {
+				return std::size( m_tape );
+			}
+
+			[[nodiscard]] daw::string_view document( ) const {
+				return m_document;
+			}
+		};
+
+		basic_json_tape( daw::string_view ) -> basic_json_tape<>;
+
+		/***
+		 * An iterator over the members of a class or the elements of an array on
+		 * a basic_json_tape.  Moving to the next one is O(1)
+		 */
+		template<json_options_t PolicyFlags>
+		class basic_json_tape_iterator {
+			basic_json_tape<PolicyFlags> const *m_tape = nullptr;
+			// For a class, the position of the member name
+			std::size_t m_pos = 0;
+			bool m_is_class = false;
+
+		public:
+			using key_type = std::string_view;
+			using mapped_type = basic_json_tape_value<PolicyFlags>;
+			using value_type = basic_json_tape_pair<PolicyFlags>;
+			using reference = value_type;
+			using pointer = json_details::arrow_proxy<value_type>;
+			using difference_type = std::ptrdiff_t;
+			using iterator_category = std::forward_iterator_tag;
+
+			basic_json_tape_iterator( ) = default;
+
+			explicit basic_json_tape_iterator(
+			  basic_json_tape<PolicyFlags> const &tape, std::size_t pos,
+			  bool is_class )
+			  : m_tape( &tape )
+			  , m_pos( pos )
+			  , m_is_class( is_class ) {}
+
+			/// @brief Name of member
+			/// @return The name, if any, of the current member
+			[[nodiscard]] std::optional<std::string_view> name( ) const {
+				if( not m_is_class ) {
+					return { };
+				}
+				auto const result = m_tape->name_at( m_pos );
+				return std::string_view( std::data( result ), std::size( result ) );
+			}
+
+			/// @return The current member/element
+			[[nodiscard]] basic_json_tape_value<PolicyFlags> value( ) const {
+				return basic_json_tape_value<PolicyFlags>(
+				  *m_tape, m_pos + static_cast<std::size_t>( m_is_class ) );
+			}
+
+			[[nodiscard]] value_type operator*( ) const {
+				return value_type{ name( ), value( ) };
+			}
+
+			[[nodiscard]] pointer operator->( ) const {
+				return { operator*( ) };
+			}
+
+			basic_json_tape_iterator &operator++( ) {
+				m_pos = m_tape->next( m_pos + static_cast<std::size_t>( m_is_class ) );
+				return *this;
+			}
+
+			basic_json_tape_iterator operator++( int ) {
+				auto result = *this;
+				operator++( );
+				return result;
+			}
+
+			[[nodiscard]] bool
+			operator==( basic_json_tape_iterator const &rhs ) const {
+				return m_pos == rhs.m_pos;
+			}
+
+			[[nodiscard]] bool
+			operator!=( basic_json_tape_iterator const &rhs ) const {
+				return m_pos != rhs.m_pos;
+			}
+		};
+
+		/***
+		 * A value on a basic_json_tape.  It has the same interface as
+		 * basic_json_value, and converts to one, so code using json_value can
+		 * switch to it.  Iterating is O(1) per member/element and the members of
+		 * large classes are found with a hash index.  It must not outlive its
+		 * tape
+		 */
+		template<json_options_t PolicyFlags>
+		class basic_json_tape_value {
+			using ParseState = json_details::no_insitu_strings_policy_t<
+			  TryDefaultParsePolicy<BasicParsePolicy<PolicyFlags>>>;
+			using tape_type = json_details::tape_type;
+
+			basic_json_tape<PolicyFlags> const *m_tape = nullptr;
+			std::size_t m_pos = 0;
+
+			[[nodiscard]] json_details::tape_entry entry( ) const {
+				return m_tape->m_tape[m_pos];
+			}
+
+			[[nodiscard]] basic_json_tape_value at_pos( std::size_t pos ) const {
+				if( pos == basic_json_tape<PolicyFlags>::npos ) {
+					return basic_json_tape_value( );
+				}
+				return basic_json_tape_value( *m_tape, pos );
+			}
+
+		public:
+			using iterator = basic_json_tape_iterator<PolicyFlags>;
+			using value_type = basic_json_tape_pair<PolicyFlags>;
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+
+			basic_json_tape_value( ) = default;
+
+			explicit basic_json_tape_value( basic_json_tape<PolicyFlags> const &tape,
+			                                std::size_t pos )
+			  : m_tape( &tape )
+			  , m_pos( pos ) {}
+
+			/// @brief Get the first member/item
+			/// @return basic_json_tape_iterator to the first item/member, or end( )
+			/// if the value is not a class or array
+			[[nodiscard]] iterator begin( ) const {
+				if( not is_class( ) and not is_array( ) ) {
+					return end( );
+				}
+				return iterator( *m_tape, m_pos + 2, is_class( ) );
+			}
+
+			/// @brief End of range over class/arrays members/items
+			[[nodiscard]] iterator end( ) const {
+				if( m_tape == nullptr ) {
+					return iterator( );
+				}
+				return iterator( *m_tape, m_tape->next( m_pos ), is_class( ) );
+			}
+
+			/// @return The number of members/elements of a class or array, otherwise
+			/// 0.  This is O(1)
+			[[nodiscard]] std::size_t size( ) const {
+				if( not is_class( ) and not is_array( ) ) {
+					return 0;
+				}
+				return m_tape->m_tape[m_pos + 1].count( );
+			}
+
+			/// @brief Query the current class for a named member.
+			/// @param name Name of member to find
+			/// @return The first member with matching name or an empty
+			/// basic_json_tape_value
+			[[nodiscard]] basic_json_tape_value
+			find_class_member( daw::string_view name ) const {
+				if( not is_class( ) ) {
+					return basic_json_tape_value( );
+				}
+				if( name.contains( '\\' ) ) {
+					return at_pos( m_tape->find_class_member_escaped( m_pos, name ) );
+				}
+				return at_pos( m_tape->find_class_member( m_pos, name ) );
+			}
+
+			/// @brief find a class member/array element as specified by the
+			/// json_path
+			[[nodiscard]] basic_json_tape_value
+			find_member( daw::string_view json_path ) const {
+				auto jv = *this;
+				while( not json_path.empty( ) and jv ) {
+					auto member = [&] {
+						if( json_path.front( ) == '[' ) {
+							return json_path.pop_front_until( ']' );
+						}
+						return json_path.pop_front_until( escaped_any_of<'.', '['>{ },
+						                                  nodiscard );
+					}( );
+					if( not json_path.empty( ) and json_path.front( ) == '.' ) {
+						json_path.remove_prefix( );
+					}
+					if( member.front( ) == '[' ) {
+						member.remove_prefix( );
+						jv = jv.find_element( json_details::parse_unsigned_int<std::size_t>(
+						  std::data( member ), daw::data_end( member ) ) );
+						if( not json_path.empty( ) and json_path.front( ) == '.' ) {
+							json_path.remove_prefix( );
+						}
+						continue;
+					}
+					jv = jv.find_class_member( member );
+				}
+				return jv;
+			}
+
+			/// @brief Query the current class for a member path
+			[[nodiscard]] basic_json_tape_value
+			operator[]( daw::string_view json_path ) const {
+				return find_member( json_path );
+			}
+
+			/// @brief Find the nth element/submember of the current json array or
+			/// class.
+			/// @return The specified member/element or an empty
+			/// basic_json_tape_value
+			[[nodiscard]] basic_json_tape_value
+			find_element( std::size_t index ) const {
+				if( not is_class( ) and not is_array( ) ) {
+					return basic_json_tape_value( );
+				}
+				return at_pos( m_tape->find_element( m_pos, index ) );
+			}
+
+			/// @brief Find the nth element of the current json array
+			/// @return The specified element or an empty basic_json_tape_value
+			[[nodiscard]] basic_json_tape_value
+			find_array_element( std::size_t index ) const {
+				assert( type( ) == JsonBaseParseTypes::Array );
+				return find_element( index );
+			}
+
+			/// @brief Find the nth element/submember of the current json array or
+			/// class.
+			[[nodiscard]] basic_json_tape_value
+			operator[]( std::size_t index ) const {
+				return find_element( index );
+			}
+
+			/// @brief Get the type of JSON value
+			/// @return a JSONBaseParseTypes enum value with the type of this JSON
+			/// value
+			[[nodiscard]] JsonBaseParseTypes type( ) const {
+				if( m_tape == nullptr ) {
+					return JsonBaseParseTypes::None;
+				}
+				switch( entry( ).type( ) ) {
+				case tape_type::Null:
+					return JsonBaseParseTypes::Null;
+				case tape_type::True:
+				case tape_type::False:
+					return JsonBaseParseTypes::Bool;
+				case tape_type::Number:
+					return JsonBaseParseTypes::Number;
+				case tape_type::String:
+					return JsonBaseParseTypes::String;
+				case tape_type::Class:
+					return JsonBaseParseTypes::Class;
+				case tape_type::Array:
+					return JsonBaseParseTypes::Array;
+				}
+				return JsonBaseParseTypes::None;
+			}
+
+			[[nodiscard]] bool is_null( ) const {
+				return type( ) == JsonBaseParseTypes::Null;
+			}
+
+			[[nodiscard]] bool is_class( ) const {
+				return type( ) == JsonBaseParseTypes::Class;
+			}
+
+			[[nodiscard]] bool is_array( ) const {
+				return type( ) == JsonBaseParseTypes::Array;
+			}
+
+			[[nodiscard]] bool is_number( ) const {
+				return type( ) == JsonBaseParseTypes::Number;
+			}
+
+			[[nodiscard]] bool is_string( ) const {
+				return type( ) == JsonBaseParseTypes::String;
+			}
+
+			[[nodiscard]] bool is_bool( ) const {
+				return type( ) == JsonBaseParseTypes::Bool;
+			}
+
+			[[nodiscard]] bool is_unknown( ) const {
+				return type( ) == JsonBaseParseTypes::None;
+			}
+
+			/// @brief The basic_json_value at the same position of the document
+			[[nodiscard]] basic_json_value<PolicyFlags> get_json_value( ) const {
+				if( m_tape == nullptr ) {
+					return basic_json_value<PolicyFlags>( );
+				}
+				return basic_json_value<PolicyFlags>(
+				  ParseState( m_tape->text_at( m_pos ),
+				              daw::data_end( m_tape->m_document ) ) );
+			}
+
+			/// @brief Copy state to a basic_json_value
+			[[nodiscard]] operator basic_json_value<PolicyFlags>( ) const {
+				return get_json_value( );
+			}
+
+			/// @brief Get a copy of the underlying parse state
+			[[nodiscard]] ParseState get_raw_state( ) const {
+				return get_json_value( ).get_raw_state( );
+			}
+
+			/// @brief Construct a string range of the current value.  Strings start
+			/// inside the quotes
+			/// @return the JSON data as a std::string_view
+			[[nodiscard]] std::string_view get_string_view( ) const {
+				if( m_tape == nullptr ) {
+					return { };
+				}
+				auto const *const first = m_tape->text_at( m_pos );
+				switch( entry( ).type( ) ) {
+				case tape_type::String:
+					return std::string_view( first + 1, entry( ).link( ) );
+				case tape_type::Number:
+					return std::string_view( first, entry( ).link( ) );
+				case tape_type::True:
+				case tape_type::Null:
+					return std::string_view( first, 4 );
+				case tape_type::False:
+					return std::string_view( first, 5 );
+				case tape_type::Class:
+				case tape_type::Array:
+					break;
+				}
+				return get_json_value( ).get_string_view( );
+			}
+
+			/// @brief Construct a string range of the current value.  Strings start
+			/// inside the quotes
+			/// @return the JSON data as a std::string
+			template<typename Alloc = std::allocator<char>,
+			         typename Traits = std::char_traits<char>>
+			[[nodiscard]] std::basic_string<char, Traits, Alloc>
+			get_string( Alloc const &alloc = Alloc( ) ) const {
+				auto const result = get_string_view( );
+				return { std::data( result ), std::size( result ), alloc };
+			}
+
+			/// @brief Parse the current json member as a Result.  The Result type
+			/// must be supported or mapped via a json_data_contract
+			template<typename Result>
+			[[nodiscard]] auto as( ) const {
+				return get_json_value( ).template as<Result>( );
+			}
+
+			template<typename Result>
+			[[nodiscard]] explicit operator Result( ) const {
+				return as<Result>( );
+			}
+
+			/// @brief Check if the value is known
+			[[nodiscard]] explicit operator bool( ) const {
+				return m_tape != nullptr;
+			}
+		};
+
+		template<typename Result, json_options_t PolicyFlags>
+		[[nodiscard]] Result as( basic_json_tape_value<PolicyFlags> const &jv ) {
+			return jv.template as<Result>( );
+		}
+
+		using json_tape = basic_json_tape<>;
+		using json_tape_value = basic_json_tape_value<>;
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
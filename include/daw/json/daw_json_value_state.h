@@ -31,8 +31,8 @@ namespace daw::json {
 			template<json_options_t PolicyFlags = default_policy_flag,
 			         typename Allocator = NoAllocator>
 			class basic_stateful_json_value_state {
-				using ParseState =
-				  TryDefaultParsePolicy<BasicParsePolicy<PolicyFlags, Allocator>>;
+				using ParseState = no_insitu_strings_policy_t<
+				  TryDefaultParsePolicy<BasicParsePolicy<PolicyFlags, Allocator>>>;
 
 			public:
 				daw::string_view name;
@@ -78,8 +78,8 @@ namespace daw::json {
 		template<json_options_t PolicyFlags = json_details::default_policy_flag,
 		         typename Allocator = json_details::NoAllocator>
 		class basic_stateful_json_value {
-			using ParseState =
-			  TryDefaultParsePolicy<BasicParsePolicy<PolicyFlags, Allocator>>;
+			using ParseState = json_details::no_insitu_strings_policy_t<
+			  TryDefaultParsePolicy<BasicParsePolicy<PolicyFlags, Allocator>>>;
 
 			basic_json_value<PolicyFlags, Allocator> m_value;
 			std::vector<
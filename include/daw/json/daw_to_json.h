@@ -18,6 +18,7 @@
 
 #include <daw/daw_traits.h>
 
+#include <cstddef>
 #include <iterator>
 #include <string>
 #include <string_view>
@@ -25,6 +26,32 @@
 
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			/// @brief A writable output that only counts the bytes written to it
+			struct counting_output {
+				std::size_t size = 0;
+			};
+		} // namespace json_details
+
+		namespace concepts {
+			template<>
+			struct writable_output_trait<json_details::counting_output>
+			  : std::true_type {
+
+				template<typename... StringViews>
+				static constexpr void write( json_details::counting_output &out,
+				                             StringViews const &...svs ) {
+					static_assert( sizeof...( StringViews ) > 0 );
+					out.size += ( std::size( svs ) + ... );
+				}
+
+				static constexpr void put( json_details::counting_output &out,
+				                           char ) {
+					++out.size;
+				}
+			};
+		} // namespace concepts
+
 		namespace json_details {
 			template<typename output_t, auto... PolicyFlags, typename WritableType>
 			DAW_ATTRIB_INLINE constexpr auto apply_policy_flags( WritableType &&it ) {
@@ -169,5 +196,23 @@ namespace daw::json {
 			result.shrink_to_fit( );
 			return result;
 		}
+
+		template<typename JsonClass, typename Value, auto... PolicyFlags>
+		constexpr std::size_t
+		json_serialized_size( Value const &value,
+		                      options::output_flags_t<PolicyFlags...> flgs ) {
+			auto out = json_details::counting_output{ };
+			(void)to_json<JsonClass>( value, out, flgs );
+			return out.size;
+		}
+
+		template<typename JsonElement, typename Container, auto... PolicyFlags>
+		constexpr std::size_t
+		json_array_serialized_size( Container const &c,
+		                            options::output_flags_t<PolicyFlags...> flgs ) {
+			auto out = json_details::counting_output{ };
+			(void)to_json_array<JsonElement>( c, out, flgs );
+			return out.size;
+		}
 	} // namespace DAW_JSON_VER
 } // namespace daw::json
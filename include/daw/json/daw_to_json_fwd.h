@@ -115,5 +115,29 @@ namespace daw::json {
 		inline std::string to_json_array(
 		  Container const &c,
 		  options::output_flags_t<PolicyFlags...> = options::output_flags<> );
+
+		/// @brief The number of bytes to_json writes for value.  It serializes
+		/// to an output that only counts, so that a buffer can be sized once
+		/// before the real serialization.  Serializing through a char pointer
+		/// into that buffer has no size checks
+		/// @tparam JsonClass Type that has json_parser_description and to_json_data
+		/// function overloads.  Defaults to deducing based on Value
+		/// @param value value to serialize
+		/// @return The size of the JSON document
+		template<typename JsonClass = use_default, typename Value,
+		         auto... PolicyFlags>
+		[[nodiscard]] constexpr std::size_t json_serialized_size(
+		  Value const &value,
+		  options::output_flags_t<PolicyFlags...> = options::output_flags<> );
+
+		/// @brief The number of bytes to_json_array writes for c
+		/// @tparam Container Type of Container to serialize the elements of
+		/// @param c Container containing data to serialize.
+		/// @return The size of the JSON document
+		template<typename JsonElement = use_default, typename Container,
+		         auto... PolicyFlags>
+		[[nodiscard]] constexpr std::size_t json_array_serialized_size(
+		  Container const &c,
+		  options::output_flags_t<PolicyFlags...> = options::output_flags<> );
 	} // namespace DAW_JSON_VER
 } // namespace daw::json
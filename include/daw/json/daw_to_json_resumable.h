@@ -0,0 +1,212 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_to_json.h"
+
+#include <daw/daw_string_view.h>
+#include <daw/daw_traits.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/// @brief Where a resumable serialization stopped.  The document is
+		/// written in steps, for an array the opening bracket, each element, and
+		/// the closing bracket
+		struct json_serialize_position {
+			/// The step being written
+			std::size_t step = 0;
+			/// The bytes of the step that were already written
+			std::size_t offset = 0;
+		};
+
+		struct json_serialize_result {
+			/// The number of bytes written to the buffer
+			std::size_t size = 0;
+			/// Pass this to the next call to continue the document
+			json_serialize_position position{ };
+			/// The whole document has been written
+			bool is_complete = false;
+		};
+
+		namespace json_details {
+			/// @brief A writable output that stores the bytes [skip, skip +
+			/// capacity) of what is written to it in a buffer, and counts all of
+			/// them.  Writing a step again with skip set to what was already
+			/// written continues it
+			struct window_output {
+				char *buffer;
+				std::size_t capacity;
+				std::size_t skip;
+				std::size_t total = 0;
+
+				inline void write( daw::string_view sv ) {
+					std::size_t const first = total;
+					total += sv.size( );
+					if( total <= skip or first >= skip + capacity ) {
+						return;
+					}
+					std::size_t const from = first < skip ? skip - first : 0;
+					std::size_t const to =
+					  ( std::min )( sv.size( ), skip + capacity - first );
+					std::memcpy( buffer + ( first + from - skip ), sv.data( ) + from,
+					             to - from );
+				}
+
+				inline void put( char c ) {
+					if( total >= skip and total < skip + capacity ) {
+						buffer[total - skip] = c;
+					}
+					++total;
+				}
+
+				/// @return The number of bytes stored in the buffer
+				[[nodiscard]] inline std::size_t written( ) const {
+					if( total <= skip ) {
+						return 0;
+					}
+					return ( std::min )( total - skip, capacity );
+				}
+			};
+
+			/// @brief Write the steps from position on into [buffer, buffer +
+			/// size), until the buffer is full or the steps are done
+			/// @param write_step Called with the step index and a window_output
+			template<typename WriteStep>
+			json_serialize_result
+			write_resumable_steps( char *buffer, std::size_t size,
+			                       json_serialize_position position,
+			                       std::size_t step_count, WriteStep write_step ) {
+				daw_json_ensure( size > 0, ErrorReason::OutputError );
+				std::size_t used = 0;
+				while( position.step < step_count ) {
+					auto window =
+					  window_output{ buffer + used, size - used, position.offset };
+					write_step( position.step, window );
+					std::size_t const written = window.written( );
+					used += written;
+					if( window.total > position.offset + written ) {
+						position.offset += written;
+						return json_serialize_result{ used, position, false };
+					}
+					++position.step;
+					position.offset = 0;
+				}
+				return json_serialize_result{ used, position, true };
+			}
+		} // namespace json_details
+
+		namespace concepts {
+			template<>
+			struct writable_output_trait<json_details::window_output>
+			  : std::true_type {
+
+				template<typename... StringViews>
+				static inline void write( json_details::window_output &out,
+				                          StringViews const &...svs ) {
+					static_assert( sizeof...( StringViews ) > 0 );
+					(void)( ( out.write( daw::string_view( svs ) ), 0 ) | ... );
+				}
+
+				static inline void put( json_details::window_output &out, char c ) {
+					out.put( c );
+				}
+			};
+		} // namespace concepts
+
+		/***
+		 * Serialize the elements of a container as a JSON array into a fixed size
+		 * buffer, continuing from position.  When the buffer fills, the result
+		 * holds the position to pass to the next call.  The output is the same
+		 * as to_json_array and no memory is allocated.
+		 *
+		 * An element that does not fit in the rest of the buffer is serialized
+		 * again on the next call, skipping the bytes already written.  The
+		 * container must not change between calls.  It must have random access
+		 * iterators, so that each call finds its size and the element it
+		 * continues at without walking it.
+		 * @tparam JsonElement The mapping of the elements.  Defaults to deducing
+		 * it from them
+		 * @param c Container containing data to serialize.
+		 * @param buffer A contiguous range of char to write to
+		 * @param position Where the previous call stopped
+		 * @return The bytes written and the position to continue from
+		 */
+		template<typename JsonElement = use_default, typename Container,
+		         typename Buffer, auto... PolicyFlags>
+		[[nodiscard]] json_serialize_result
+		to_json_array_resumable( Container const &c, Buffer &&buffer,
+		                         json_serialize_position position = { },
+		                         options::output_flags_t<PolicyFlags...> =
+		                           options::output_flags<> ) {
+			static_assert(
+			  daw::traits::is_container_like_v<daw::remove_cvref_t<Container>>,
+			  "Supplied container must support begin( )/end( )" );
+			using iterator_category = typename std::iterator_traits<
+			  decltype( std::begin( c ) )>::iterator_category;
+			static_assert( std::is_base_of_v<std::random_access_iterator_tag,
+			                                 iterator_category>,
+			               "to_json_array_resumable requires random access "
+			               "iterators" );
+			using policy_t =
+			  serialization_policy<json_details::window_output,
+			                       options::output_flags_t<PolicyFlags...>::value>;
+
+			auto const element_count = static_cast<std::size_t>(
+			  std::distance( std::begin( c ), std::end( c ) ) );
+			// Steps are the opening bracket, the elements, and the closing bracket
+			auto const first = std::begin( c );
+			return json_details::write_resumable_steps(
+			  std::data( buffer ), std::size( buffer ), position, element_count + 2,
+			  [&]( std::size_t step, json_details::window_output &out ) {
+				  auto out_it = policy_t( out );
+				  if( step == 0 ) {
+					  out_it.put( '[' );
+					  return;
+				  }
+				  out_it.add_indent( );
+				  if( step == element_count + 1 ) {
+					  out_it.del_indent( );
+					  if( element_count > 0 ) {
+						  out_it.output_newline( );
+					  }
+					  out_it.put( ']' );
+					  return;
+				  }
+				  (void)[&out_it]( auto &&v ) {
+					  using v_type = DAW_TYPEOF( v );
+					  using JsonMember = typename daw::conditional_t<
+					    std::is_same_v<JsonElement, use_default>,
+					    json_details::ident_trait<json_details::json_deduced_type,
+					                              v_type>,
+					    json_details::ident_trait<json_details::json_deduced_type,
+					                              JsonElement>>::type;
+					  static_assert(
+					    not std::is_same_v<
+					      JsonMember,
+					      missing_json_data_contract_for_or_unknown_type<JsonElement>>,
+					    "Unable to detect unnamed mapping" );
+					  out_it.next_member( );
+					  out_it = json_details::member_to_string<JsonMember>( out_it, v );
+				  }
+				  ( first[static_cast<std::ptrdiff_t>( step - 1U )] );
+				  if( step < element_count ) {
+					  out_it.put( ',' );
+				  }
+			  } );
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
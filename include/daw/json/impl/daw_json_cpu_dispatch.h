@@ -0,0 +1,127 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include <cstdint>
+
+#if defined( DAW_JSON_CPU_DISPATCH )
+#if defined( _MSC_VER ) and not defined( __clang__ )
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details::cpu_dispatch {
+			/// @brief The widest set of SIMD kernels usable on the current CPU
+			enum class simd_level : std::uint8_t { generic, sse42, avx2, avx512 };
+
+			struct cpuid_result {
+				std::uint32_t eax;
+				std::uint32_t ebx;
+				std::uint32_t ecx;
+				std::uint32_t edx;
+			};
+
+			inline cpuid_result cpuid( std::uint32_t leaf, std::uint32_t subleaf ) {
+#if defined( _MSC_VER ) and not defined( __clang__ )
+				int regs[4];
+				__cpuidex( regs, static_cast<int>( leaf ),
+				           static_cast<int>( subleaf ) );
+				return { static_cast<std::uint32_t>( regs[0] ),
+				         static_cast<std::uint32_t>( regs[1] ),
+				         static_cast<std::uint32_t>( regs[2] ),
+				         static_cast<std::uint32_t>( regs[3] ) };
+#else
+				unsigned eax = 0;
+				unsigned ebx = 0;
+				unsigned ecx = 0;
+				unsigned edx = 0;
+				__cpuid_count( leaf, subleaf, eax, ebx, ecx, edx );
+				return { eax, ebx, ecx, edx };
+#endif
+			}
+
+			/// @brief The register state the OS saves on context switches.  Only
+			/// valid when cpuid reports OSXSAVE
+			inline std::uint64_t xgetbv0( ) {
+#if defined( _MSC_VER ) and not defined( __clang__ )
+				return static_cast<std::uint64_t>( _xgetbv( 0 ) );
+#else
+				std::uint32_t eax = 0;
+				std::uint32_t edx = 0;
+				__asm__ volatile( "xgetbv" : "=a"( eax ), "=d"( edx ) : "c"( 0 ) );
+				return ( static_cast<std::uint64_t>( edx ) << 32U ) | eax;
+#endif
+			}
+
+			inline simd_level detect_simd_level( ) {
+				auto const has_bit = []( std::uint32_t reg, unsigned bit ) {
+					return ( ( reg >> bit ) & 1U ) != 0;
+				};
+				std::uint32_t const max_leaf = cpuid( 0, 0 ).eax;
+				if( max_leaf < 1 ) {
+					return simd_level::generic;
+				}
+				cpuid_result const leaf1 = cpuid( 1, 0 );
+				bool const has_sse42 =
+				  has_bit( leaf1.ecx, 20 ) and has_bit( leaf1.ecx, 1 ); // pclmul
+				if( not has_sse42 ) {
+					return simd_level::generic;
+				}
+				// The CPU supporting AVX is not enough, the OS must also save the
+				// wider registers
+				bool const has_osxsave = has_bit( leaf1.ecx, 27 );
+				if( max_leaf < 7 or not has_osxsave ) {
+					return simd_level::sse42;
+				}
+				std::uint64_t const xcr0 = xgetbv0( );
+				cpuid_result const leaf7 = cpuid( 7, 0 );
+				// XMM, YMM
+				bool const os_avx = ( xcr0 & 0x06U ) == 0x06U;
+				// XMM, YMM, opmask, ZMM0-15, ZMM16-31
+				bool const os_avx512 = ( xcr0 & 0xE6U ) == 0xE6U;
+				if( os_avx512 and has_bit( leaf7.ebx, 16 ) and
+				    has_bit( leaf7.ebx, 30 ) ) {
+					return simd_level::avx512;
+				}
+				if( os_avx and has_bit( leaf7.ebx, 5 ) ) {
+					return simd_level::avx2;
+				}
+				return simd_level::sse42;
+			}
+
+			/// @brief The SIMD level of the current CPU, detected once on first use
+			inline simd_level current_simd_level( ) {
+				static simd_level const level = detect_simd_level( );
+				return level;
+			}
+
+			/// @brief Choose the kernel matching the current CPU
+			template<typename Fn>
+			Fn select_kernel( Fn generic, Fn sse42, Fn avx2, Fn avx512 ) {
+				switch( current_simd_level( ) ) {
+				case simd_level::avx512:
+					return avx512;
+				case simd_level::avx2:
+					return avx2;
+				case simd_level::sse42:
+					return sse42;
+				case simd_level::generic:
+					break;
+				}
+				return generic;
+			}
+		} // namespace json_details::cpu_dispatch
+	}   // namespace DAW_JSON_VER
+} // namespace daw::json
+#endif
@@ -22,14 +22,58 @@ namespace daw::json {
 			static constexpr std::string_view name = "runtime";
 			static constexpr bool can_constexpr = false;
 		};
-#if defined( DAW_ALLOW_SSE42 )
+#if defined( DAW_JSON_HAS_SSE42_KERNELS )
 		struct sse42_exec_tag : runtime_exec_tag {
 			static constexpr std::string_view name = "sse4.2";
 			static constexpr bool can_constexpr = false;
 		};
+#endif
+#if defined( DAW_ALLOW_SSE42 )
 		using simd_exec_tag = sse42_exec_tag;
 #else
 		struct simd_exec_tag : runtime_exec_tag {};
+#endif
+#if defined( DAW_JSON_HAS_AVX2_KERNELS )
+		/// @brief Use the 32 byte wide AVX2 kernels where available and fallback
+		/// to the sse4.2 ones elsewhere
+		struct avx2_exec_tag : sse42_exec_tag {
+			static constexpr std::string_view name = "avx2";
+			static constexpr bool can_constexpr = false;
+		};
+#else
+		using avx2_exec_tag = simd_exec_tag;
+#endif
+#if defined( DAW_JSON_HAS_AVX512_KERNELS )
+		/// @brief Use the 64 byte wide AVX512BW kernels where available and
+		/// fallback to the AVX2 ones elsewhere
+		struct avx512_exec_tag : avx2_exec_tag {
+			static constexpr std::string_view name = "avx512";
+			static constexpr bool can_constexpr = false;
+		};
+#else
+		using avx512_exec_tag = avx2_exec_tag;
+#endif
+		/// @brief The tags selected by ExecModeTypes::avx2 and
+		/// ExecModeTypes::avx512.  When the instruction set is not allowed at
+		/// compile time they are the next narrower mode
+#if defined( DAW_ALLOW_AVX2 )
+		using simd256_exec_tag = avx2_exec_tag;
+#else
+		using simd256_exec_tag = simd_exec_tag;
+#endif
+#if defined( DAW_ALLOW_AVX512 )
+		using simd512_exec_tag = avx512_exec_tag;
+#else
+		using simd512_exec_tag = simd256_exec_tag;
+#endif
+#if defined( DAW_JSON_CPU_DISPATCH )
+		/// @brief Select the widest SIMD kernels the CPU supports at runtime
+		struct cpu_dispatch_exec_tag : runtime_exec_tag {
+			static constexpr std::string_view name = "cpu_dispatch";
+			static constexpr bool can_constexpr = false;
+		};
+#else
+		using cpu_dispatch_exec_tag = runtime_exec_tag;
 #endif
 		using default_exec_tag = constexpr_exec_tag;
 	} // namespace DAW_JSON_VER
@@ -24,7 +24,9 @@
 #include <daw/daw_uint_buffer.h>
 
 #include <cstddef>
+#include <cstdint>
 #include <daw/stdinc/data_access.h>
+#include <type_traits>
 
 #if defined( DAW_JSON_PARSER_DIAGNOSTICS )
 #include <cmath>
@@ -96,12 +98,214 @@ namespace daw::json {
 				}
 			};
 
+			// Should never be called outside a consteval context
+			template<typename... MemberNames>
+			static inline DAW_CONSTEVAL bool do_hashes_collide( ) {
+				daw::UInt32 hashes[sizeof...( MemberNames )]{
+				  name_hash<false>( MemberNames::name )... };
+
+				daw::sort( std::data( hashes ), daw::data_end( hashes ) );
+				return daw::algorithm::adjacent_find(
+				         std::data( hashes ), daw::data_end( hashes ),
+				         []( UInt32 l, UInt32 r ) DAW_JSON_CPP23_STATIC_CALL_OP {
+					         return l == r;
+				         } ) != daw::data_end( hashes );
+			}
+
+			/// @brief Classes with fewer members than this search the member hashes
+			/// linearly
+			inline constexpr std::size_t member_perfect_hash_min_size = 4;
+
+			/***
+			 * A compile time minimal perfect hash of the member name hashes of a
+			 * class.  The hashes are split into buckets and each bucket is given a
+			 * seed that places all of its hashes into empty slots, largest buckets
+			 * first.  A lookup is a load of the bucket seed and a load of the slot,
+			 * independent of the number of members.
+			 * @tparam MemberCount Number of mapped members from json_class
+			 */
+			template<std::size_t MemberCount>
+			struct member_perfect_hash {
+				static_assert( MemberCount < 0xFFFFU,
+				               "Too many members for a member_perfect_hash" );
+				using index_t = std::uint16_t;
+				/// Slots are only added when no seed can be found for a table the
+				/// size of MemberCount
+				static constexpr std::size_t max_table_size = MemberCount * 2U;
+
+				bool is_valid = false;
+				std::uint32_t table_size = 0;
+				index_t seeds[MemberCount]{ };
+				/// The member index for each slot, MemberCount when empty
+				index_t slots[max_table_size]{ };
+
+				[[nodiscard]] DAW_ATTRIB_INLINE static constexpr std::uint32_t
+				mix( UInt32 hash, std::uint32_t seed ) {
+					auto h = static_cast<std::uint32_t>( hash ) ^ ( seed * 0x9E37'79B9U );
+					h ^= h >> 16U;
+					h *= 0x85EB'CA6BU;
+					h ^= h >> 13U;
+					h *= 0xC2B2'AE35U;
+					h ^= h >> 16U;
+					return h;
+				}
+
+				/// @brief Map h to [0, n) without a division
+				[[nodiscard]] DAW_ATTRIB_INLINE static constexpr std::size_t
+				reduce( std::uint32_t h, std::size_t n ) {
+					return static_cast<std::size_t>(
+					  ( static_cast<std::uint64_t>( h ) * n ) >> 32U );
+				}
+
+				[[nodiscard]] DAW_ATTRIB_INLINE static constexpr std::size_t
+				bucket_of( UInt32 hash ) {
+					return reduce( mix( hash, 0 ), MemberCount );
+				}
+
+				[[nodiscard]] DAW_ATTRIB_INLINE static constexpr std::size_t
+				slot_of( UInt32 hash, std::uint32_t seed, std::size_t table_size ) {
+					return reduce( mix( hash, seed + 1U ), table_size );
+				}
+
+				/// @brief The only member that can have hash
+				/// @return The member index, or MemberCount when no member can.  The
+				/// caller must still compare the hash
+				[[nodiscard]] DAW_ATTRIB_INLINE constexpr std::size_t
+				find( UInt32 hash ) const {
+					return slots[slot_of( hash, seeds[bucket_of( hash )], table_size )];
+				}
+			};
+
+			// Should never be called outside a consteval context
+			template<std::size_t MemberCount>
+			DAW_CONSTEVAL bool
+			try_place_member_hashes( member_perfect_hash<MemberCount> &result,
+			                         UInt32 const *hashes ) {
+				using ph_t = member_perfect_hash<MemberCount>;
+				using index_t = typename ph_t::index_t;
+				for( auto &slot : result.slots ) {
+					slot = static_cast<index_t>( MemberCount );
+				}
+				// Group the members by bucket
+				std::size_t bucket_sizes[MemberCount]{ };
+				std::size_t bucket_starts[MemberCount + 1]{ };
+				std::size_t bucket_fill[MemberCount]{ };
+				std::size_t members_by_bucket[MemberCount]{ };
+				for( std::size_t n = 0; n < MemberCount; ++n ) {
+					++bucket_sizes[ph_t::bucket_of( hashes[n] )];
+				}
+				std::size_t max_bucket_size = 0;
+				for( std::size_t b = 0; b < MemberCount; ++b ) {
+					bucket_starts[b + 1] = bucket_starts[b] + bucket_sizes[b];
+					bucket_fill[b] = bucket_starts[b];
+					if( bucket_sizes[b] > max_bucket_size ) {
+						max_bucket_size = bucket_sizes[b];
+					}
+				}
+				for( std::size_t n = 0; n < MemberCount; ++n ) {
+					members_by_bucket[bucket_fill[ph_t::bucket_of( hashes[n] )]++] = n;
+				}
+				// The larger buckets are placed first while most slots are free
+				for( std::size_t sz = max_bucket_size; sz > 0; --sz ) {
+					for( std::size_t b = 0; b < MemberCount; ++b ) {
+						if( bucket_sizes[b] != sz ) {
+							continue;
+						}
+						std::size_t const first = bucket_starts[b];
+						std::size_t const last = bucket_starts[b + 1];
+						bool is_placed = false;
+						for( std::uint32_t seed = 0; seed < 0xFFFFU and not is_placed;
+						     ++seed ) {
+							std::size_t k = first;
+							for( ; k < last; ++k ) {
+								std::size_t const member = members_by_bucket[k];
+								std::size_t const slot =
+								  ph_t::slot_of( hashes[member], seed, result.table_size );
+								if( result.slots[slot] != MemberCount ) {
+									break;
+								}
+								result.slots[slot] = static_cast<index_t>( member );
+							}
+							if( k == last ) {
+								result.seeds[b] = static_cast<index_t>( seed );
+								is_placed = true;
+							} else {
+								// Undo the partial placement
+								for( std::size_t j = first; j < k; ++j ) {
+									result.slots[ph_t::slot_of( hashes[members_by_bucket[j]],
+									                            seed, result.table_size )] =
+									  static_cast<index_t>( MemberCount );
+								}
+							}
+						}
+						if( not is_placed ) {
+							return false;
+						}
+					}
+				}
+				return true;
+			}
+
+			// Should never be called outside a consteval context
+			template<typename... MemberNames>
+			DAW_CONSTEVAL auto make_member_perfect_hash( ) {
+				constexpr std::size_t member_count = sizeof...( MemberNames );
+				using ph_t = member_perfect_hash<member_count>;
+				if constexpr( member_count < member_perfect_hash_min_size ) {
+					return ph_t{ };
+				} else {
+					if( do_hashes_collide<MemberNames...>( ) ) {
+						return ph_t{ };
+					}
+					UInt32 const hashes[member_count]{
+					  name_hash<false>( MemberNames::name )... };
+					for( std::size_t table_size = member_count;
+					     table_size <= ph_t::max_table_size;
+					     table_size += ( member_count + 7U ) / 8U ) {
+						auto result = ph_t{ };
+						result.table_size = static_cast<std::uint32_t>( table_size );
+						if( try_place_member_hashes( result, hashes ) ) {
+							result.is_valid = true;
+							return result;
+						}
+					}
+					return ph_t{ };
+				}
+			}
+
+			/// @brief Used by locations_info_t when a class is searched linearly
+			struct no_member_perfect_hash {
+				static constexpr bool is_valid = false;
+			};
+
+			/// @brief The perfect hash of the member names of a class.  It is kept
+			/// out of locations_info_t so that it is not copied for each parse
+			template<typename... JsonMembers>
+			struct member_perfect_hash_for {
+				static constexpr auto table =
+				  make_member_perfect_hash<JsonMembers...>( );
+				static constexpr bool is_valid = table.is_valid;
+			};
+
+#if defined( DAW_JSON_NO_MEMBER_PERFECT_HASH )
+			template<typename... JsonMembers>
+			using member_perfect_hash_t = no_member_perfect_hash;
+#else
+			template<typename... JsonMembers>
+			using member_perfect_hash_t = std::conditional_t<
+			  ( sizeof...( JsonMembers ) >= member_perfect_hash_min_size ),
+			  member_perfect_hash_for<JsonMembers...>, no_member_perfect_hash>;
+#endif
+
 			/***
 			 * Contains an array of member location_info mapped in a json_class
 			 * @tparam MemberCount Number of mapped members from json_class
+			 * @tparam PerfectHash member_perfect_hash_for the members, or
+			 * no_member_perfect_hash to search the hashes linearly
 			 */
 			template<std::size_t MemberCount, typename CharT,
-			         bool DoFullNameMatch = true>
+			         bool DoFullNameMatch = true,
+			         typename PerfectHash = no_member_perfect_hash>
 			struct locations_info_t {
 				using value_type = location_info_t<DoFullNameMatch, CharT>;
 				using reference = value_type &;
@@ -124,52 +328,79 @@ namespace daw::json {
 					return MemberCount;
 				}
 
+				/// @brief Does member n have the hash, and name when a full name match
+				/// is needed
+				[[nodiscard]] DAW_ATTRIB_INLINE constexpr bool
+				is_member( std::size_t n, UInt32 hash, daw::string_view key ) const {
+					if( hashes[n] != hash ) {
+						return false;
+					}
+					if constexpr( do_full_name_match ) {
+						return key == names[n].name;
+					} else {
+						(void)key;
+						return true;
+					}
+				}
+
 				template<bool expect_long_strings, std::size_t start_pos>
 				[[nodiscard]] DAW_ATTRIB_INLINE constexpr std::size_t
 				find_name( daw::string_view key ) const {
 					UInt32 const hash = name_hash<expect_long_strings>( key );
+					if constexpr( PerfectHash::is_valid ) {
 #if defined( DAW_JSON_BUGFIX_MSVC_EVAL_ORDER_002 )
-					(void)start_pos;
-					for( std::size_t n = 0; n < MemberCount; ++n ) {
+						(void)start_pos;
+						std::size_t const n = PerfectHash::table.find( hash );
 #else
-					for( std::size_t n = start_pos; n < MemberCount; ++n ) {
+						// Members are most often in order
+						if constexpr( start_pos < MemberCount ) {
+							if( DAW_LIKELY( is_member( start_pos, hash, key ) ) ) {
+								return start_pos;
+							}
+						}
+						std::size_t const n = PerfectHash::table.find( hash );
+						if constexpr( start_pos > 0 ) {
+							// Members before start_pos have already been found
+							if( n < start_pos ) {
+								return MemberCount;
+							}
+						}
+#endif
+						if( n < MemberCount and is_member( n, hash, key ) ) {
+							return n;
+						}
+						return MemberCount;
+					} else {
+#if defined( DAW_JSON_BUGFIX_MSVC_EVAL_ORDER_002 )
+						(void)start_pos;
+						for( std::size_t n = 0; n < MemberCount; ++n ) {
+#else
+						for( std::size_t n = start_pos; n < MemberCount; ++n ) {
 #endif
-						if( hashes[n] == hash ) {
-							if constexpr( do_full_name_match ) {
-								if( DAW_UNLIKELY( key != names[n].name ) ) {
-									continue;
+							if( hashes[n] == hash ) {
+								if constexpr( do_full_name_match ) {
+									if( DAW_UNLIKELY( key != names[n].name ) ) {
+										continue;
+									}
 								}
+								return n;
 							}
-							return n;
 						}
+						return MemberCount;
 					}
-					return MemberCount;
 				}
 			};
 
-			// Should never be called outside a consteval context
-			template<typename... MemberNames>
-			static inline DAW_CONSTEVAL bool do_hashes_collide( ) {
-				daw::UInt32 hashes[sizeof...( MemberNames )]{
-				  name_hash<false>( MemberNames::name )... };
-
-				daw::sort( std::data( hashes ), daw::data_end( hashes ) );
-				return daw::algorithm::adjacent_find(
-				         std::data( hashes ), daw::data_end( hashes ),
-				         []( UInt32 l, UInt32 r ) DAW_JSON_CPP23_STATIC_CALL_OP {
-					         return l == r;
-				         } ) != daw::data_end( hashes );
-			}
-
 			// Should never be called outside a consteval context
 			template<typename ParseState, typename... JsonMembers>
 			DAW_ATTRIB_FLATINLINE static inline DAW_JSON_MAKE_LOC_INFO_CONSTEVAL auto
 			make_locations_info( ) {
 				using CharT = typename ParseState::CharT;
+				using perfect_hash_t = member_perfect_hash_t<JsonMembers...>;
 #if defined( DAW_JSON_ALWAYS_FULL_NAME_MATCH )
 				constexpr bool do_full_name_match = true;
 				return locations_info_t<sizeof...( JsonMembers ), CharT,
-				                        do_full_name_match>{
+				                        do_full_name_match, perfect_hash_t>{
 				  { daw::name_hash<false>( JsonMembers::name )... },
 				  { location_info_t<do_full_name_match, CharT>{
 				    JsonMembers::name }... } };
@@ -180,13 +411,13 @@ namespace daw::json {
 				  do_hashes_collide<JsonMembers...>( );
 				if constexpr( do_full_name_match ) {
 					return locations_info_t<sizeof...( JsonMembers ), CharT,
-					                        do_full_name_match>{
+					                        do_full_name_match, perfect_hash_t>{
 					  { daw::name_hash<false>( JsonMembers::name )... },
 					  { location_info_t<do_full_name_match, CharT>{
 					    JsonMembers::name }... } };
 				} else {
 					return locations_info_t<sizeof...( JsonMembers ), CharT,
-					                        do_full_name_match>{
+					                        do_full_name_match, perfect_hash_t>{
 					  { daw::name_hash<false>( JsonMembers::name )... }, {} };
 				}
 #endif
@@ -205,10 +436,10 @@ namespace daw::json {
 
 			template<std::size_t pos, AllMembersMustExist must_exist,
 			         bool from_start = false, std::size_t N, typename ParseState,
-			         bool B, typename CharT>
+			         bool B, typename CharT, typename PH>
 			[[nodiscard]] DAW_ATTRIB_INLINE static constexpr find_result<ParseState>
 			find_class_member( ParseState &parse_state,
-			                   locations_info_t<N, CharT, B> &locations,
+			                   locations_info_t<N, CharT, B, PH> &locations,
 			                   bool is_nullable, daw::string_view member_name ) {
 
 				// silencing gcc9 warning as these are selectively used
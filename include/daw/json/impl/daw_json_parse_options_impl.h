@@ -35,6 +35,12 @@ namespace daw::json {
 					return "runtime";
 				case ExecModeTypes::simd:
 					return "simd";
+				case ExecModeTypes::avx2:
+					return "avx2";
+				case ExecModeTypes::avx512:
+					return "avx512";
+				case ExecModeTypes::cpu_dispatch:
+					return "cpu_dispatch";
 				}
 				DAW_UNREACHABLE( );
 			}
@@ -43,7 +49,7 @@ namespace daw::json {
 		namespace json_details {
 			template<>
 			inline constexpr unsigned json_option_bits_width<options::ExecModeTypes> =
-			  2;
+			  3;
 
 			template<>
 			inline constexpr auto default_json_option_value<options::ExecModeTypes> =
@@ -158,13 +164,31 @@ namespace daw::json {
 			  default_json_option_value<options::ExcludeSpecialEscapes> =
 			    options::ExcludeSpecialEscapes::no;
 
+			template<>
+			inline constexpr unsigned
+			  json_option_bits_width<options::UseStructuralIndex> = 1;
+
+			template<>
+			inline constexpr auto
+			  default_json_option_value<options::UseStructuralIndex> =
+			    options::UseStructuralIndex::no;
+
+			template<>
+			inline constexpr unsigned
+			  json_option_bits_width<options::InSituStrings> = 1;
+
+			template<>
+			inline constexpr auto default_json_option_value<options::InSituStrings> =
+			  options::InSituStrings::no;
+
 			using policy_list = typename option_list_impl<
 			  options::ExecModeTypes, options::ZeroTerminatedString,
 			  options::PolicyCommentTypes, options::CheckedParseMode,
 			  options::AllowEscapedNames, options::IEEE754Precise,
 			  options::ForceFullNameCheck, options::MinifiedDocument,
 			  options::UseExactMappingsByDefault, options::MustVerifyEndOfDataIsValid,
-			  options::ExcludeSpecialEscapes, options::ExpectLongNames>::type;
+			  options::ExcludeSpecialEscapes, options::ExpectLongNames,
+			  options::UseStructuralIndex, options::InSituStrings>::type;
 
 			template<typename Policy, typename Policies>
 			inline constexpr unsigned basic_policy_bits_start =
@@ -19,6 +19,7 @@
 #include "daw_json_parse_policy_no_comments.h"
 #include "daw_json_parse_policy_policy_details.h"
 #include "daw_json_string_util.h"
+#include "daw_json_structural_index.h"
 
 #include <daw/cpp_17.h>
 #include <daw/daw_attributes.h>
@@ -29,6 +30,7 @@
 #include <cstddef>
 #include <iterator>
 #include <type_traits>
+#include <utility>
 
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
@@ -44,7 +46,11 @@ namespace daw::json {
 		///
 		template<json_options_t PolicyFlags = json_details::default_policy_flag,
 		         typename Allocator = json_details::NoAllocator>
-		struct BasicParsePolicy : json_details::AllocatorWrapper<Allocator> {
+		struct BasicParsePolicy
+		  : json_details::AllocatorWrapper<Allocator>,
+		    json_details::StructuralIndexWrapper<
+		      json_details::get_bits_for<options::UseStructuralIndex>(
+		        PolicyFlags ) == options::UseStructuralIndex::yes> {
 
 			static constexpr bool is_default_parse_policy =
 			  PolicyFlags == json_details::default_policy_flag and
@@ -83,7 +89,8 @@ namespace daw::json {
 			using exec_tag_t =
 			  switch_t<json_details::get_bits_for<options::ExecModeTypes,
 			                                      std::size_t>( PolicyFlags ),
-			           constexpr_exec_tag, runtime_exec_tag, simd_exec_tag>;
+			           constexpr_exec_tag, runtime_exec_tag, simd_exec_tag,
+			           simd256_exec_tag, simd512_exec_tag, cpu_dispatch_exec_tag>;
 
 			static constexpr exec_tag_t exec_tag = exec_tag_t{ };
 
@@ -144,6 +151,20 @@ namespace daw::json {
 			  json_details::get_bits_for<options::ExpectLongNames>( PolicyFlags ) ==
 			  options::ExpectLongNames::yes;
 
+			/***
+			 * See options::UseStructuralIndex
+			 */
+			static constexpr bool use_structural_index =
+			  json_details::get_bits_for<options::UseStructuralIndex>(
+			    PolicyFlags ) == options::UseStructuralIndex::yes;
+
+			/***
+			 * See options::InSituStrings
+			 */
+			static constexpr bool is_insitu_strings =
+			  json_details::get_bits_for<options::InSituStrings>( PolicyFlags ) ==
+			  options::InSituStrings::yes;
+
 			using CommentPolicy =
 			  switch_t<json_details::get_bits_for<options::PolicyCommentTypes,
 			                                      std::size_t>( PolicyFlags ),
@@ -239,6 +260,7 @@ namespace daw::json {
 					auto result = with_allocator( first, last, class_first, class_last,
 					                              p.get_allocator( ) );
 					result.counter = p.counter;
+					result.set_structural_index( p.get_structural_index( ) );
 					return result;
 				}
 			}
@@ -249,6 +271,7 @@ namespace daw::json {
 				auto result =
 				  with_allocator( first, last, class_first, class_last, alloc );
 				result.counter = counter;
+				result.set_structural_index( this->get_structural_index( ) );
 				return result;
 			}
 
@@ -499,7 +522,44 @@ namespace daw::json {
 				  *this );
 			}
 
+			/// @brief Find the bracketed item starting at first in the structural
+			/// index
+			/// @return The index entry or nullptr when there is no index or the
+			/// item is not in it
+			template<char PrimLeft>
+			[[nodiscard]] json_details::structural_index::entry const *
+			find_indexed_item( ) {
+				json_details::structural_index const *index =
+				  this->get_structural_index( );
+				if( index == nullptr or first >= last or *first != PrimLeft ) {
+					return nullptr;
+				}
+				auto const *item = index->find( first, this->structural_cursor( ) );
+				if( item == nullptr or
+				    static_cast<std::ptrdiff_t>( item->close ) >
+				      ( last - index->data( ) ) ) {
+					return nullptr;
+				}
+				return item;
+			}
+
+			/// @brief Jump over a bracketed item found in the structural index.
+			/// The result is the same as skip_bracketed_item_checked
+			[[nodiscard]] BasicParsePolicy
+			skip_indexed_item( json_details::structural_index::entry const &item ) {
+				auto result = *this;
+				result.last = this->get_structural_index( )->data( ) + item.close;
+				result.counter = item.count;
+				first = result.last;
+				return result;
+			}
+
 			[[nodiscard]] DAW_ATTRIB_INLINE constexpr BasicParsePolicy skip_class( ) {
+				if constexpr( use_structural_index ) {
+					if( auto const *item = find_indexed_item<'{'>( ) ) {
+						return skip_indexed_item( *item );
+					}
+				}
 				if constexpr( is_unchecked_input ) {
 					return skip_bracketed_item_unchecked<'{'>( );
 				} else {
@@ -508,6 +568,11 @@ namespace daw::json {
 			}
 
 			[[nodiscard]] DAW_ATTRIB_INLINE constexpr BasicParsePolicy skip_array( ) {
+				if constexpr( use_structural_index ) {
+					if( auto const *item = find_indexed_item<'['>( ) ) {
+						return skip_indexed_item( *item );
+					}
+				}
 				if constexpr( is_unchecked_input ) {
 					return skip_bracketed_item_unchecked<'['>( );
 				} else {
@@ -555,6 +620,77 @@ namespace daw::json {
 		  daw::conditional_t<ParsePolicy::is_default_parse_policy,
 		                     DefaultParsePolicy, ParsePolicy>;
 
+		namespace json_details {
+			/***
+			 * @brief The policy of a parser that reads each string of a String
+			 * document once, like from_json.  options::InSituStrings decodes the
+			 * strings into the document, so it must be mutable.
+			 */
+			template<typename ParsePolicy, typename String>
+			struct insitu_document_policy {
+				static_assert(
+				  not ParsePolicy::is_insitu_strings or
+				    not std::is_const_v<std::remove_reference_t<decltype(
+				      *std::data( std::declval<String &>( ) ) )>>,
+				  "options::InSituStrings writes to the document, so it must be "
+				  "mutable" );
+				using type = ParsePolicy;
+			};
+
+			template<typename ParsePolicy, typename String>
+			using insitu_document_policy_t =
+			  typename insitu_document_policy<ParsePolicy, String>::type;
+
+			/***
+			 * @brief The policy of a parser that can read a string again, such as
+			 * an iterator that parses on each dereference.  A string decoded by
+			 * options::InSituStrings no longer has its escapes, so the option is
+			 * rejected.
+			 */
+			template<typename ParsePolicy>
+			struct no_insitu_strings_policy {
+				static_assert( not ParsePolicy::is_insitu_strings,
+				               "options::InSituStrings is only supported by "
+				               "from_json and from_json_array" );
+				using type = ParsePolicy;
+			};
+
+			template<typename ParsePolicy>
+			using no_insitu_strings_policy_t =
+			  typename no_insitu_strings_policy<ParsePolicy>::type;
+
+			/***
+			 * @brief A copy of parse_state that leaves strings as they are in the
+			 * document.  Used for a value that is read again later, like the tag
+			 * of a variant.
+			 */
+			template<typename ParseState>
+			[[nodiscard]] constexpr auto
+			without_insitu_strings( ParseState const &parse_state ) {
+				if constexpr( ParseState::is_insitu_strings ) {
+					using result_t = typename ParseState::template SetPolicyOptions<
+					  options::InSituStrings::no>;
+					auto result = [&] {
+						if constexpr( ParseState::has_allocator ) {
+							return result_t( parse_state.first, parse_state.last,
+							                 parse_state.class_first,
+							                 parse_state.class_last,
+							                 parse_state.get_allocator( ) );
+						} else {
+							return result_t( parse_state.first, parse_state.last,
+							                 parse_state.class_first,
+							                 parse_state.class_last );
+						}
+					}( );
+					result.counter = parse_state.counter;
+					result.set_structural_index( parse_state.get_structural_index( ) );
+					return result;
+				} else {
+					return parse_state;
+				}
+			}
+		} // namespace json_details
+
 		namespace options {
 			/***
 			 * @brief Specify parse policy flags in to_json calls.  See cookbook item
@@ -48,6 +48,23 @@ namespace daw::json {
 				}
 			}
 
+			/// Only runs of whitespace, like indentation, are worth the wide
+			/// kernels
+			template<typename ParseState>
+			DAW_ATTRIB_FLATINLINE static constexpr void
+			skip_whitespace_run( ParseState &parse_state ) {
+				if constexpr( json_details::has_wide_kernels_v<
+				                typename ParseState::exec_tag_t> ) {
+					if( parse_state.has_more( ) and
+					    parse_policy_details::is_whitespace( parse_state.front( ) ) ) {
+						parse_state.first = json_details::mem_skip_whitespace(
+						  ParseState::exec_tag, parse_state.first, parse_state.last );
+					}
+				} else {
+					(void)parse_state;
+				}
+			}
+
 			template<typename ParseState>
 			DAW_ATTRIB_FLATINLINE static constexpr void
 			skip_comments( ParseState &parse_state ) {
@@ -65,6 +82,7 @@ namespace daw::json {
 				skip_comments_checked( parse_state );
 				while( parse_state.has_more( ) and parse_state.is_space_unchecked( ) ) {
 					parse_state.remove_prefix( );
+					skip_whitespace_run( parse_state );
 					skip_comments_checked( parse_state );
 				}
 			}
@@ -75,6 +93,7 @@ namespace daw::json {
 				skip_comments_unchecked( parse_state );
 				while( parse_state.is_space_unchecked( ) ) {
 					parse_state.remove_prefix( );
+					skip_whitespace_run( parse_state );
 				}
 			}
 
@@ -124,6 +143,15 @@ namespace daw::json {
 					++ptr_first;
 				}
 				while( DAW_LIKELY( ptr_first < ptr_last ) ) {
+					if constexpr( json_details::has_wide_kernels_v<
+					                typename ParseState::exec_tag_t> ) {
+						ptr_first = json_details::mem_move_to_next_of<
+						  ParseState::is_unchecked_input, '"', ',', '[', ']', '{', '}',
+						  '\\', '#'>( ParseState::exec_tag, ptr_first, ptr_last );
+						if( DAW_UNLIKELY( ptr_first >= ptr_last ) ) {
+							break;
+						}
+					}
 					// TODO: use if/else if or put switch into IILE
 					switch( *ptr_first ) {
 					case '\\':
@@ -205,6 +233,12 @@ namespace daw::json {
 					++ptr_first;
 				}
 				while( true ) {
+					if constexpr( json_details::has_wide_kernels_v<
+					                typename ParseState::exec_tag_t> ) {
+						ptr_first = json_details::mem_move_to_next_of<
+						  ParseState::is_unchecked_input, '"', ',', '[', ']', '{', '}',
+						  '\\', '#'>( ParseState::exec_tag, ptr_first, parse_state.last );
+					}
 					switch( *ptr_first ) {
 					case '\\':
 						++ptr_first;
@@ -42,6 +42,17 @@ namespace daw::json {
 					// only used when not zero terminated string and gcc9 warns
 					(void)last;
 
+					if constexpr( json_details::has_wide_kernels_v<
+					                typename ParseState::exec_tag_t> ) {
+						// Only runs of whitespace, like indentation, are worth the wide
+						// kernels
+						if( last - first >= 2 and
+						    parse_policy_details::is_whitespace( first[0] ) and
+						    parse_policy_details::is_whitespace( first[1] ) ) {
+							first = json_details::mem_skip_whitespace(
+							  ParseState::exec_tag, first + 2, last );
+						}
+					}
 					if constexpr( ParseState::is_zero_terminated_string ) {
 						// Ensure that zero terminator isn't included in skipable value
 						while( DAW_UNLIKELY(
@@ -70,6 +81,16 @@ namespace daw::json {
 				} else {
 					using CharT = typename ParseState::CharT;
 					CharT *first = parse_state.first;
+					if constexpr( json_details::has_wide_kernels_v<
+					                typename ParseState::exec_tag_t> ) {
+						CharT *const last = parse_state.last;
+						if( last - first >= 2 and
+						    parse_policy_details::is_whitespace( first[0] ) and
+						    parse_policy_details::is_whitespace( first[1] ) ) {
+							first = json_details::mem_skip_whitespace(
+							  ParseState::exec_tag, first + 2, last );
+						}
+					}
 					while( DAW_UNLIKELY(
 					  ( static_cast<unsigned>( static_cast<unsigned char>( *first ) ) -
 					    1U ) <= 0x1F ) ) {
@@ -161,6 +182,15 @@ namespace daw::json {
 					++ptr_first;
 				}
 				while( DAW_LIKELY( ptr_first < ptr_last ) ) {
+					if constexpr( json_details::has_wide_kernels_v<
+					                typename ParseState::exec_tag_t> ) {
+						ptr_first = json_details::mem_move_to_next_of<
+						  ParseState::is_unchecked_input, '"', ',', '[', ']', '{', '}',
+						  '\\'>( ParseState::exec_tag, ptr_first, ptr_last );
+						if( DAW_UNLIKELY( ptr_first >= ptr_last ) ) {
+							break;
+						}
+					}
 					switch( *ptr_first ) {
 					case '\\':
 						++ptr_first;
@@ -232,6 +262,12 @@ namespace daw::json {
 					++ptr_first;
 				}
 				while( true ) {
+					if constexpr( json_details::has_wide_kernels_v<
+					                typename ParseState::exec_tag_t> ) {
+						ptr_first = json_details::mem_move_to_next_of<
+						  ParseState::is_unchecked_input, '"', ',', '[', ']', '{', '}',
+						  '\\'>( ParseState::exec_tag, ptr_first, parse_state.last );
+					}
 					switch( *ptr_first ) {
 					case '\\':
 						++ptr_first;
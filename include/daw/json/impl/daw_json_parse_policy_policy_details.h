@@ -41,6 +41,14 @@ namespace daw::json {
 				                              static_cast<unsigned char>( '0' ) ) < 10U;
 			}
 
+			/// Whitespace, and other control characters, but not the zero
+			/// terminator
+			[[nodiscard]] DAW_ATTRIB_FLATINLINE static inline constexpr bool
+			is_whitespace( char c ) {
+				return ( static_cast<unsigned>( static_cast<unsigned char>( c ) ) -
+				         1U ) <= 0x1FU;
+			}
+
 			template<typename ParseState>
 			DAW_ATTRIB_FLATINLINE static inline constexpr void
 			validate_unsigned_first( ParseState const &parse_state ) {
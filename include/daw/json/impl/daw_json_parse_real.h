@@ -13,12 +13,14 @@
 #include "daw_fp_fallback.h"
 #include "daw_json_assert.h"
 #include "daw_json_parse_policy_policy_details.h"
+#include "daw_json_parse_real_eisel_lemire.h"
 #include "daw_json_parse_real_power10.h"
 #include "daw_json_parse_unsigned_int.h"
 #include "daw_json_skip.h"
 #include "daw_json_type_options.h"
 
 #include <daw/daw_cxmath.h>
+#include <daw/daw_is_constant_evaluated.h>
 #include <daw/daw_likely.h>
 #include <daw/daw_restrict.h>
 #include <daw/daw_utility.h>
@@ -66,6 +68,25 @@ namespace daw::json {
 				(void)last;
 
 				Unsigned value = v;
+				if constexpr( std::is_same_v<Unsigned, std::uint64_t> ) {
+					// Classify 8 characters at a time and parse the digits found as a
+					// block.  The digits left are handled one at a time below
+					while( last - first >= 8 ) {
+						auto const chunk = daw::to_uint64_buffer( first );
+						std::size_t const digit_count = count_leading_digits_8( chunk );
+						if( digit_count == 0 ) {
+							break;
+						}
+						value *= powers_of_ten_8[digit_count];
+						value += static_cast<std::uint64_t>(
+						  parse_up_to_8_digits( chunk, digit_count ) );
+						first += digit_count;
+						if( digit_count < 8 ) {
+							v = value;
+							return first;
+						}
+					}
+				}
 				if constexpr( skip_end_check ) {
 					for( auto dig = parse_digit( *first ); dig < 10U;
 					     ++first, dig = parse_digit( *first ) ) {
@@ -90,29 +111,85 @@ namespace daw::json {
 				return first;
 			}
 
-			/// @brief Check if we have more significant digits that can be stored in
-			/// the type, usually uint64_t
-			template<typename ParseState, typename Result,
-			         typename max_storage_digits, typename CharT>
-			[[nodiscard]] inline constexpr bool
-			should_use_strtod( CharT *whole_first, CharT *whole_last,
-			                   CharT *fract_first, CharT *fract_last ) {
-				if constexpr( std::is_floating_point_v<Result> and
-				              ParseState::precise_ieee754 ) {
-					return DAW_UNLIKELY(
-					  ( ( whole_last - whole_first ) +
-					    ( fract_first ? fract_last - fract_first : 0 ) ) >
-					  max_storage_digits::value );
+			/// @brief Eisel-Lemire for float and double.  When the digits that were
+			/// dropped decide the rounding, Precise falls back to parse_with_strtod
+			/// and otherwise the truncated significand is used
+			template<typename Result, bool Precise, typename CharT>
+			[[nodiscard]] static Result
+			real_from_eisel_lemire( bool is_negative, std::uint64_t significand,
+			                        std::int64_t exponent, bool is_truncated,
+			                        CharT *orig_first, CharT *orig_last ) {
+				Result result{ };
+				if( DAW_LIKELY( eisel_lemire( is_negative, significand, exponent,
+				                              is_truncated, result ) ) ) {
+					return result;
+				}
+				if constexpr( Precise ) {
+					return parse_with_strtod<Result>( orig_first, orig_last );
 				} else {
-					// avoid -Wunused-but-set-parameter in gcc warnings
-					(void)whole_first;
-					(void)whole_last;
-					(void)fract_first;
-					(void)fract_last;
-					return false;
+					(void)orig_first;
+					(void)orig_last;
+					return result;
 				}
 			}
 
+			/// @brief Convert the significand and power of ten parsed from the
+			/// document to a Result.  Float and double use the exact Clinger fast
+			/// path when it applies and Eisel-Lemire otherwise.  Only when digits
+			/// that were dropped decide the rounding does the precise policy fall
+			/// back to parse_with_strtod
+			/// @param is_truncated Significant digits after significand were not
+			/// parsed
+			template<typename Result, typename ParseState, typename Unsigned,
+			         typename Signed, typename CharT>
+			[[nodiscard]] DAW_ATTRIB_INLINE static constexpr Result
+			decimal_to_real( Result sign, Unsigned significand, Signed exponent,
+			                 bool is_truncated, CharT *orig_first,
+			                 CharT *orig_last ) {
+				if constexpr( is_eisel_lemire_real_v<Result> ) {
+					using format = eisel_lemire_format<Result>;
+					if( DAW_LIKELY( not is_truncated and
+					                exponent >= -format::max_fast_exponent and
+					                exponent <= format::max_fast_exponent and
+					                significand <= format::max_fast_significand ) ) {
+						return sign * power10<Result>( ParseState::exec_tag,
+						                               static_cast<Result>( significand ),
+						                               exponent );
+					}
+					if constexpr( ParseState::precise_ieee754 ) {
+						// The fallback is not constexpr either
+						return real_from_eisel_lemire<Result, true>(
+						  sign < 0, significand, exponent, is_truncated, orig_first,
+						  orig_last );
+					} else {
+#if defined( DAW_IS_CONSTANT_EVALUATED )
+						if( not DAW_IS_CONSTANT_EVALUATED( ) ) {
+#else
+						if constexpr( not std::is_same_v<typename ParseState::exec_tag_t,
+						                                 constexpr_exec_tag> ) {
+#endif
+							return real_from_eisel_lemire<Result, false>(
+							  sign < 0, significand, exponent, is_truncated, orig_first,
+							  orig_last );
+						}
+					}
+				} else if constexpr( std::is_floating_point_v<Result> and
+				                     ParseState::precise_ieee754 ) {
+					// long double
+					if( DAW_UNLIKELY( is_truncated or exponent > 22 or exponent < -22 or
+					                  significand > 9007199254740992ULL ) ) {
+						return parse_with_strtod<Result>( orig_first, orig_last );
+					}
+				} else {
+					(void)is_truncated;
+					(void)orig_first;
+					(void)orig_last;
+				}
+				return sign * power10<Result>( ParseState::exec_tag,
+				                               static_cast<Result>( significand ),
+				                               exponent );
+			}
+
 			template<typename Result, typename ParseState>
 			[[nodiscard]] DAW_ATTRIB_INLINE static constexpr Result
 			parse_real_known( ParseState &parse_state ) {
@@ -146,10 +223,6 @@ namespace daw::json {
 				using max_storage_digits = daw::constant<static_cast<std::ptrdiff_t>(
 				  daw::numeric_limits<std::uint64_t>::digits10 )>;
 
-				bool use_strtod =
-				  should_use_strtod<ParseState, Result, max_storage_digits>(
-				    whole_first, whole_last, fract_first, fract_last );
-
 				Result const sign = [&] {
 					if( *whole_first == '-' ) {
 						++whole_first;
@@ -167,39 +240,49 @@ namespace daw::json {
 				  typename daw::conditional_t<std::is_floating_point_v<unsigned_t>,
 				                              daw::traits::identity<unsigned_t>,
 				                              std::make_signed<unsigned_t>>::type;
+				signed_t exponent = 0;
+				if( fract_first and whole_last - whole_first == 1 and
+				    *whole_first == '0' ) {
+					// Neither a zero whole part nor the leading zeros of the fraction
+					// are significant digits, they only move the exponent
+					whole_first = whole_last;
+					CharT *const zeros_first = fract_first;
+					while( fract_first < fract_last and *fract_first == '0' ) {
+						++fract_first;
+					}
+					exponent -= static_cast<signed_t>( fract_first - zeros_first );
+				}
 				std::intmax_t whole_exponent_available = whole_last - whole_first;
 				std::intmax_t fract_exponent_available =
 				  fract_first ? fract_last - fract_first : 0;
-				signed_t exponent = 0;
+				bool is_truncated = false;
 
 				if( whole_exponent_available > max_exponent::value ) {
 					whole_last = whole_first + max_exponent::value;
 					whole_exponent_available -= max_exponent::value;
 					fract_exponent_available = 0;
 					fract_first = nullptr;
-					exponent = whole_exponent_available;
+					exponent += static_cast<signed_t>( whole_exponent_available );
+					is_truncated = true;
 				} else {
 					whole_exponent_available =
 					  max_exponent::value - whole_exponent_available;
-					if constexpr( ParseState::precise_ieee754 ) {
-						use_strtod |= DAW_UNLIKELY( fract_exponent_available >
-						                            whole_exponent_available );
-					}
 					if( whole_exponent_available < fract_exponent_available ) {
 						fract_exponent_available = whole_exponent_available;
+						is_truncated = true;
 					}
-					exponent = -fract_exponent_available;
+					exponent -= static_cast<signed_t>( fract_exponent_available );
 					fract_last = fract_first + fract_exponent_available;
 				}
 
+				// The ranges are bounded to the digits that fit, so the end check is
+				// always needed
 				unsigned_t significant_digits = 0;
-				parse_digits_until_last<( ParseState::is_zero_terminated_string or
-				                          ParseState::is_unchecked_input )>(
-				  whole_first, whole_last, significant_digits );
+				parse_digits_until_last<false>( whole_first, whole_last,
+				                                significant_digits );
 				if( fract_first ) {
-					parse_digits_until_last<( ParseState::is_zero_terminated_string or
-					                          ParseState::is_unchecked_input )>(
-					  fract_first, fract_last, significant_digits );
+					parse_digits_until_last<false>( fract_first, fract_last,
+					                                significant_digits );
 				}
 
 				if( exp_first and ( exp_last - exp_first ) > 0 ) {
@@ -251,27 +334,15 @@ namespace daw::json {
 					  }( ),
 					  exp_sign );
 				}
-				if constexpr( std::is_floating_point_v<Result> and
+				if constexpr( std::is_same_v<Result, long double> and
 				              ParseState::precise_ieee754 ) {
-					// On std floating point types, check for conditions that cannot be
-					// precisely calculated using the normal method and use the fallback
-					// method(usually strtod/from_chars)
-					use_strtod |= exponent > 22;
-					use_strtod |= exponent < -22;
-					use_strtod |= significant_digits > 9007199254740992ULL;
-					if constexpr( std::is_same_v<Result, long double> ) {
-						return json_details::parse_with_strtod<Result>( parse_state.first,
-						                                                parse_state.last );
-					} else {
-						if( DAW_UNLIKELY( use_strtod ) ) {
-							return json_details::parse_with_strtod<Result>(
-							  parse_state.first, parse_state.last );
-						}
-					}
+					return parse_with_strtod<Result>( parse_state.first,
+					                                  parse_state.last );
+				} else {
+					return decimal_to_real<Result, ParseState>(
+					  sign, significant_digits, exponent, is_truncated,
+					  parse_state.first, parse_state.last );
 				}
-				return sign * power10<Result>(
-				                ParseState::exec_tag,
-				                static_cast<Result>( significant_digits ), exponent );
 			}
 
 			template<typename Result, typename ParseState>
@@ -287,11 +358,6 @@ namespace daw::json {
 				CharT *const orig_first = parse_state.first;
 				CharT *const orig_last = parse_state.last;
 
-				// silencing gcc9 warning as these are only used when precise ieee is in
-				// play.
-				(void)orig_first;
-				(void)orig_last;
-
 				auto const sign = static_cast<Result>(
 				  parse_policy_details::validate_signed_first( parse_state ) );
 
@@ -312,21 +378,16 @@ namespace daw::json {
 				  ( std::min )( parse_state.last - parse_state.first,
 				                static_cast<std::ptrdiff_t>( max_exponent::value ) );
 
+				// The digit ranges are bounded to what fits in significant_digits, so
+				// the end check is always needed
 				unsigned_t significant_digits = 0;
-				CharT *last_char =
-				  parse_digits_while_number<( ParseState::is_zero_terminated_string or
-				                              ParseState::is_unchecked_input )>(
-				    first, whole_last, significant_digits );
-				std::ptrdiff_t sig_digit_count = last_char - parse_state.first;
-				bool use_strtod =
-				  std::is_floating_point_v<Result> and ParseState::precise_ieee754 and
-				  DAW_UNLIKELY( sig_digit_count > max_storage_digits::value );
+				CharT *last_char = parse_digits_while_number<false>(
+				  first, whole_last, significant_digits );
+				// Significant digits were skipped as they do not fit
+				bool is_truncated = false;
 				signed_t exponent_p1 = [&] {
-					if( DAW_UNLIKELY( last_char >= whole_last ) ) {
-						if constexpr( std::is_floating_point_v<Result> and
-						              ParseState::precise_ieee754 ) {
-							use_strtod = true;
-						}
+					if( DAW_UNLIKELY( last_char >= whole_last and
+					                  last_char < parse_state.last ) ) {
 						// We have sig digits we cannot parse because there isn't enough
 						// room in a std::uint64_t
 						CharT *ptr = skip_digits<( ParseState::is_zero_terminated_string or
@@ -338,6 +399,7 @@ namespace daw::json {
 						if( significant_digits == 0 ) {
 							return signed_t{ 0 };
 						}
+						is_truncated = diff > 0;
 						return static_cast<signed_t>( diff );
 					}
 					return signed_t{ 0 };
@@ -348,6 +410,7 @@ namespace daw::json {
 				      ParseState::is_unchecked_input or
 				      DAW_LIKELY( first < parse_state.last ) ) and
 				    *first == '.' ) {
+					std::ptrdiff_t whole_digits = first - parse_state.first;
 					++first;
 					if( exponent_p1 != 0 ) {
 						if( first < parse_state.last ) {
@@ -356,17 +419,23 @@ namespace daw::json {
 							  first, parse_state.last );
 						}
 					} else {
+						if( significant_digits == 0 ) {
+							// Neither a zero whole part nor the leading zeros of the
+							// fraction are significant, they only move the exponent
+							whole_digits = 0;
+							CharT *const zeros_first = first;
+							while( first < parse_state.last and *first == '0' ) {
+								++first;
+							}
+							exponent_p1 -= static_cast<signed_t>( first - zeros_first );
+						}
 						CharT *fract_last =
 						  first + ( std::min )( parse_state.last - first,
 						                        static_cast<std::ptrdiff_t>(
-						                          max_exponent::value -
-						                          ( first - parse_state.first ) ) );
+						                          max_exponent::value - whole_digits ) );
 
-						last_char = parse_digits_while_number<(
-						  ParseState::is_zero_terminated_string or
-						  ParseState::is_unchecked_input )>( first, fract_last,
-						                                     significant_digits );
-						sig_digit_count += last_char - first;
+						last_char = parse_digits_while_number<false>( first, fract_last,
+						                                              significant_digits );
 						exponent_p1 -= static_cast<signed_t>( last_char - first );
 						first = last_char;
 						if( ( first >= fract_last ) & ( first < parse_state.last ) ) {
@@ -374,10 +443,7 @@ namespace daw::json {
 							  skip_digits<( ParseState::is_zero_terminated_string or
 							                ParseState::is_unchecked_input )>(
 							    first, parse_state.last );
-							if constexpr( std::is_floating_point_v<Result> and
-							              ParseState::precise_ieee754 ) {
-								use_strtod |= new_first > first;
-							}
+							is_truncated |= new_first > first;
 							first = new_first;
 						}
 					}
@@ -456,25 +522,9 @@ namespace daw::json {
 					}
 				}( );
 				parse_state.first = first;
-
-				if constexpr( std::is_floating_point_v<Result> and
-				              ParseState::precise_ieee754 ) {
-					use_strtod |= DAW_UNLIKELY( exponent > 22 );
-					use_strtod |= DAW_UNLIKELY( exponent < -22 );
-					use_strtod |=
-					  DAW_UNLIKELY( significant_digits > 9007199254740992ULL );
-					if( DAW_UNLIKELY( use_strtod ) ) {
-						using json_details::parse_with_strtod;
-						auto result = parse_with_strtod<Result>( orig_first, orig_last );
-						/*auto x =
-						  fallback_fp<Result>( result, sign, significant_digits, exponent );
-						(void)x;*/
-						return result;
-					}
-				}
-				return sign * power10<Result>(
-				                ParseState::exec_tag,
-				                static_cast<Result>( significant_digits ), exponent );
+				return decimal_to_real<Result, ParseState>(
+				  sign, significant_digits, exponent, is_truncated, orig_first,
+				  orig_last );
 			}
 
 			template<typename Result, bool KnownRange, typename ParseState>
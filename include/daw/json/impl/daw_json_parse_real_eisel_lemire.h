@@ -0,0 +1,261 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include "power_of_five_128_table.h"
+
+#include <daw/daw_attributes.h>
+#include <daw/daw_bit_cast.h>
+#include <daw/daw_likely.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			/***
+			 * Conversion of a decimal significand and power of ten to the nearest
+			 * float or double with the Eisel-Lemire algorithm.  This follows
+			 * fast_float, https://github.com/fastfloat/fast_float, and uses the
+			 * truncated 128bit powers of five in pow5_tbl.
+			 *
+			 * Daniel Lemire, Number Parsing at a Gigabyte per Second,
+			 * Software: Practice and Experience 51 (8), 2021
+			 */
+			template<typename Real>
+			struct eisel_lemire_format;
+
+			template<>
+			struct eisel_lemire_format<double> {
+				using bits_t = std::uint64_t;
+				static constexpr int mantissa_explicit_bits = 52;
+				static constexpr int minimum_exponent = -1023;
+				static constexpr int infinite_power = 0x7FF;
+				static constexpr int sign_index = 63;
+				static constexpr int min_exponent_round_to_even = -4;
+				static constexpr int max_exponent_round_to_even = 23;
+				static constexpr std::int64_t smallest_power_of_ten = -342;
+				static constexpr std::int64_t largest_power_of_ten = 308;
+				/// Clinger's fast path, both the significand and the power of ten
+				/// are exact and a single multiply or divide rounds correctly
+				static constexpr std::int64_t max_fast_exponent = 22;
+				static constexpr std::uint64_t max_fast_significand = 1ULL << 53U;
+			};
+
+			template<>
+			struct eisel_lemire_format<float> {
+				using bits_t = std::uint32_t;
+				static constexpr int mantissa_explicit_bits = 23;
+				static constexpr int minimum_exponent = -127;
+				static constexpr int infinite_power = 0xFF;
+				static constexpr int sign_index = 31;
+				static constexpr int min_exponent_round_to_even = -17;
+				static constexpr int max_exponent_round_to_even = 10;
+				static constexpr std::int64_t smallest_power_of_ten = -65;
+				static constexpr std::int64_t largest_power_of_ten = 38;
+				static constexpr std::int64_t max_fast_exponent = 10;
+				static constexpr std::uint64_t max_fast_significand = 1ULL << 24U;
+			};
+
+			template<typename Real>
+			inline constexpr bool is_eisel_lemire_real_v =
+			  std::is_same_v<Real, double> or std::is_same_v<Real, float>;
+
+			inline constexpr std::int64_t eisel_lemire_smallest_power_of_five = -342;
+
+			struct eisel_lemire_u128 {
+				std::uint64_t low;
+				std::uint64_t high;
+			};
+
+			[[nodiscard]] DAW_ATTRIB_INLINE constexpr eisel_lemire_u128
+			eisel_lemire_full_multiply( std::uint64_t a, std::uint64_t b ) {
+#if defined( __SIZEOF_INT128__ )
+#if defined( __GNUC__ )
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#endif
+				auto const r = static_cast<unsigned __int128>( a ) * b;
+#if defined( __GNUC__ )
+#pragma GCC diagnostic pop
+#endif
+				return { static_cast<std::uint64_t>( r ),
+				         static_cast<std::uint64_t>( r >> 64U ) };
+#else
+				auto const a_lo = a & 0xFFFF'FFFFULL;
+				auto const a_hi = a >> 32U;
+				auto const b_lo = b & 0xFFFF'FFFFULL;
+				auto const b_hi = b >> 32U;
+				auto const lo_lo = a_lo * b_lo;
+				auto const hi_lo = a_hi * b_lo;
+				auto const lo_hi = a_lo * b_hi;
+				auto const hi_hi = a_hi * b_hi;
+				auto const cross =
+				  ( lo_lo >> 32U ) + ( hi_lo & 0xFFFF'FFFFULL ) + lo_hi;
+				return { ( cross << 32U ) | ( lo_lo & 0xFFFF'FFFFULL ),
+				         ( hi_lo >> 32U ) + ( cross >> 32U ) + hi_hi };
+#endif
+			}
+
+			[[nodiscard]] DAW_ATTRIB_INLINE constexpr int
+			eisel_lemire_leading_zeros( std::uint64_t value ) {
+#if DAW_HAS_BUILTIN( __builtin_clzll )
+				return __builtin_clzll( static_cast<unsigned long long>( value ) );
+#else
+				int result = 0;
+				while( ( value & 0x8000'0000'0000'0000ULL ) == 0 ) {
+					value <<= 1U;
+					++result;
+				}
+				return result;
+#endif
+			}
+
+			/// @brief The product of w and 5^q, exact in the bits needed for a
+			/// mantissa of BitPrecision bits.  The second half of the power of five
+			/// is only used when the first product is not precise enough
+			template<int BitPrecision>
+			[[nodiscard]] DAW_ATTRIB_INLINE constexpr eisel_lemire_u128
+			eisel_lemire_product( std::int64_t q, std::uint64_t w ) {
+				auto const index = static_cast<std::size_t>(
+				  2 * ( q - eisel_lemire_smallest_power_of_five ) );
+				constexpr std::uint64_t precision_mask =
+				  0xFFFF'FFFF'FFFF'FFFFULL >> static_cast<unsigned>( BitPrecision );
+				auto first = eisel_lemire_full_multiply( w, pow5_tbl[index] );
+				if( DAW_UNLIKELY( ( first.high & precision_mask ) ==
+				                  precision_mask ) ) {
+					auto const second =
+					  eisel_lemire_full_multiply( w, pow5_tbl[index + 1] );
+					first.low += second.high;
+					if( second.high > first.low ) {
+						++first.high;
+					}
+				}
+				return first;
+			}
+
+			/// @brief The binary exponent and mantissa, without the implicit bit,
+			/// of a float or double
+			struct eisel_lemire_result {
+				std::uint64_t mantissa;
+				std::int32_t power2;
+
+				[[nodiscard]] constexpr bool
+				operator==( eisel_lemire_result const &rhs ) const {
+					return mantissa == rhs.mantissa and power2 == rhs.power2;
+				}
+
+				[[nodiscard]] constexpr bool
+				operator!=( eisel_lemire_result const &rhs ) const {
+					return not( *this == rhs );
+				}
+			};
+
+			/// @brief Round w * 10^q to the nearest Real, ties to even.  The 128bit
+			/// product is always precise enough for the significands of 19 or fewer
+			/// digits, so no fallback is needed here.
+			template<typename Real>
+			[[nodiscard]] constexpr eisel_lemire_result
+			eisel_lemire_compute( std::int64_t q, std::uint64_t w ) {
+				using format = eisel_lemire_format<Real>;
+				constexpr auto mantissa_bits = format::mantissa_explicit_bits;
+				if( w == 0 or q < format::smallest_power_of_ten ) {
+					return { 0, 0 };
+				}
+				if( q > format::largest_power_of_ten ) {
+					return { 0, format::infinite_power };
+				}
+				int const lz = eisel_lemire_leading_zeros( w );
+				w <<= static_cast<unsigned>( lz );
+				auto const product =
+				  eisel_lemire_product<mantissa_bits + 3>( q, w );
+				auto const upper_bit = static_cast<int>( product.high >> 63U );
+				auto const shift =
+				  static_cast<unsigned>( upper_bit + 64 - mantissa_bits - 3 );
+				eisel_lemire_result result{ product.high >> shift, 0 };
+				// floor( log2( 10^q ) ) + 63
+				auto const power = static_cast<std::int32_t>(
+				  ( ( ( 152170 + 65536 ) * q ) >> 16 ) + 63 );
+				result.power2 =
+				  power + upper_bit - lz - static_cast<std::int32_t>(
+				                             format::minimum_exponent );
+				if( result.power2 <= 0 ) {
+					// Subnormal
+					if( -result.power2 + 1 >= 64 ) {
+						return { 0, 0 };
+					}
+					result.mantissa >>= static_cast<unsigned>( -result.power2 + 1 );
+					result.mantissa += result.mantissa & 1U;
+					result.mantissa >>= 1U;
+					result.power2 =
+					  result.mantissa < ( 1ULL << static_cast<unsigned>( mantissa_bits ) )
+					    ? 0
+					    : 1;
+					return result;
+				}
+				// Exactly halfway between two values, round to even instead of up
+				if( product.low <= 1 and q >= format::min_exponent_round_to_even and
+				    q <= format::max_exponent_round_to_even and
+				    ( result.mantissa & 3U ) == 1U and
+				    ( result.mantissa << shift ) == product.high ) {
+					result.mantissa &= ~1ULL;
+				}
+				result.mantissa += result.mantissa & 1U;
+				result.mantissa >>= 1U;
+				if( result.mantissa >=
+				    ( 2ULL << static_cast<unsigned>( mantissa_bits ) ) ) {
+					result.mantissa = 1ULL << static_cast<unsigned>( mantissa_bits );
+					++result.power2;
+				}
+				result.mantissa &= ~( 1ULL << static_cast<unsigned>( mantissa_bits ) );
+				if( result.power2 >= format::infinite_power ) {
+					return { 0, format::infinite_power };
+				}
+				return result;
+			}
+
+			template<typename Real>
+			[[nodiscard]] DAW_ATTRIB_INLINE Real
+			eisel_lemire_to_real( bool is_negative, eisel_lemire_result r ) {
+				using format = eisel_lemire_format<Real>;
+				using bits_t = typename format::bits_t;
+				auto bits =
+				  r.mantissa | ( static_cast<std::uint64_t>( r.power2 )
+				                 << static_cast<unsigned>(
+				                      format::mantissa_explicit_bits ) );
+				if( is_negative ) {
+					bits |= 1ULL << static_cast<unsigned>( format::sign_index );
+				}
+				return daw::bit_cast<Real>( static_cast<bits_t>( bits ) );
+			}
+
+			/// @brief Convert w * 10^q to a float or double.
+			/// @param is_truncated More significant digits followed w in the
+			/// document and were dropped.  The result is only known when w and w + 1
+			/// round to the same value
+			/// @return false when the digits that were dropped decide the rounding.
+			/// Only then is a slower arbitrary precision fallback needed
+			template<typename Real>
+			[[nodiscard]] DAW_ATTRIB_INLINE bool
+			eisel_lemire( bool is_negative, std::uint64_t w, std::int64_t q,
+			              bool is_truncated, Real &out ) {
+				auto const result = eisel_lemire_compute<Real>( q, w );
+				out = eisel_lemire_to_real<Real>( is_negative, result );
+				if( is_truncated and w != 0xFFFF'FFFF'FFFF'FFFFULL ) {
+					return result == eisel_lemire_compute<Real>( q, w + 1U );
+				}
+				return true;
+			}
+		} // namespace json_details
+	}   // namespace DAW_JSON_VER
+} // namespace daw::json
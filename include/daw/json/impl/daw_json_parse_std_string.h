@@ -195,6 +195,78 @@ namespace daw::json {
 				inline constexpr char const escape_quotes[] = "\\\"";
 			}
 
+			/***
+			 * Decode the escapes of a string in place, for options::InSituStrings.
+			 * An escape never decodes to more bytes than it has, so each byte is
+			 * written at or before where it was read.  The bytes left between the
+			 * decoded string and the closing quote are set to spaces, so no part of
+			 * an escape is left in front of the quote.
+			 * @param parse_state The string, without its quotes, in a mutable
+			 * document
+			 * @return The end of the decoded string
+			 */
+			template<bool AllowHighEight, typename ParseState>
+			[[nodiscard]] static constexpr char const *
+			decode_string_insitu( ParseState parse_state ) {
+				// Only parsers that read each string of a mutable document once allow
+				// this option, see insitu_document_policy
+				char *it = const_cast<char *>( parse_state.first );
+				while( parse_state.has_more( ) ) {
+					char const c = parse_state.front( );
+					if( c != '\\' ) {
+						if constexpr( not AllowHighEight ) {
+							daw_json_assert_weak(
+							  static_cast<unsigned char>( c ) <= 0x7FU,
+							  ErrorReason::InvalidStringHighASCII, parse_state );
+						}
+						*it++ = c;
+						parse_state.remove_prefix( );
+						continue;
+					}
+					parse_state.remove_prefix( );
+					daw_json_assert_weak( parse_state.has_more( ),
+					                      ErrorReason::UnexpectedEndOfData, parse_state );
+					switch( parse_state.front( ) ) {
+					case 'b':
+						*it++ = '\b';
+						break;
+					case 'f':
+						*it++ = '\f';
+						break;
+					case 'n':
+						*it++ = '\n';
+						break;
+					case 'r':
+						*it++ = '\r';
+						break;
+					case 't':
+						*it++ = '\t';
+						break;
+					case 'u':
+						it = decode_utf16( parse_state, it );
+						continue;
+					case '/':
+					case '\\':
+					case '"':
+						*it++ = parse_state.front( );
+						break;
+					default:
+						if constexpr( not AllowHighEight ) {
+							daw_json_assert_weak(
+							  static_cast<unsigned char>( parse_state.front( ) ) <= 0x7FU,
+							  ErrorReason::InvalidStringHighASCII, parse_state );
+						}
+						*it++ = parse_state.front( );
+					}
+					parse_state.remove_prefix( );
+				}
+				char *const decoded_last = it;
+				while( it != parse_state.last ) {
+					*it++ = ' ';
+				}
+				return decoded_last;
+			}
+
 			// Fast path for parsing escaped strings to a std::string with the default
 			// appender
 			template<bool AllowHighEight, typename JsonMember, bool KnownBounds,
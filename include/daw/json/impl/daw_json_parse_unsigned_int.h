@@ -23,8 +23,10 @@
 #include <daw/daw_uint_buffer.h>
 
 #include <cstddef>
+#include <cstdint>
 #include <daw/stdinc/data_access.h>
 #include <limits>
+#include <type_traits>
 
 #if defined( DAW_ALLOW_SSE42 )
 #include <emmintrin.h>
@@ -90,8 +92,7 @@ namespace daw::json {
 
 			// Constexpr'ified version from
 			// https://kholdstare.github.io/technical/2020/05/26/faster-integer-parsing.html
-			inline constexpr UInt64 parse_8_digits( char const *const str ) {
-				auto const chunk = daw::to_uint64_buffer( str );
+			inline constexpr UInt64 parse_8_digits( UInt64 const chunk ) {
 				// 1-byte mask trick (works on 4 pairs of single digits)
 				auto const lower_digits =
 				  ( chunk & 0x0F'00'0F'00'0F'00'0F'00_u64 ) >> 8U;
@@ -116,6 +117,10 @@ namespace daw::json {
 				return chunk4 & 0xFFFF'FFFF_u64;
 			}
 
+			inline constexpr UInt64 parse_8_digits( char const *const str ) {
+				return parse_8_digits( daw::to_uint64_buffer( str ) );
+			}
+
 			static_assert( parse_8_digits( "12345678" ) == 1234'5678_u64,
 			               "8 digit parser does not work on this platform" );
 
@@ -129,6 +134,63 @@ namespace daw::json {
 			                 1234567890123456_u64,
 			               "16 digit parser does not work on this platform" );
 
+			[[nodiscard]] DAW_ATTRIB_INLINE constexpr std::size_t
+			count_trailing_zeros_u64( std::uint64_t value ) {
+#if DAW_HAS_BUILTIN( __builtin_ctzll )
+				return static_cast<std::size_t>(
+				  __builtin_ctzll( static_cast<unsigned long long>( value ) ) );
+#else
+				std::size_t result = 0;
+				while( ( value & 1U ) == 0 ) {
+					value >>= 1U;
+					++result;
+				}
+				return result;
+#endif
+			}
+
+			/// @brief Classify the 8 characters in chunk, loaded in memory order, all
+			/// at once and count how many leading characters are digits
+			[[nodiscard]] DAW_ATTRIB_INLINE constexpr std::size_t
+			count_leading_digits_8( UInt64 const chunk ) {
+				// Digits become 0-9 and every other character has either the high bit
+				// set or a value that sets it when 0x76 is added.  The high bit is
+				// masked first so that no byte carries into the next
+				auto const v =
+				  static_cast<std::uint64_t>( chunk ) ^ 0x3030'3030'3030'3030ULL;
+				auto const non_digits =
+				  ( ( ( v & 0x7F7F'7F7F'7F7F'7F7FULL ) + 0x7676'7676'7676'7676ULL ) |
+				    v ) &
+				  0x8080'8080'8080'8080ULL;
+				if( non_digits == 0 ) {
+					return 8;
+				}
+				return count_trailing_zeros_u64( non_digits ) / 8U;
+			}
+
+			static_assert( count_leading_digits_8( daw::to_uint64_buffer(
+			                 static_cast<char const *>( "1234,678" ) ) ) == 4,
+			               "Digit classification does not work on this platform" );
+
+			inline constexpr std::uint64_t powers_of_ten_8[9] = {
+			  1ULL,      10ULL,      100ULL,        1'000ULL,      10'000ULL,
+			  100'000ULL, 1'000'000ULL, 10'000'000ULL, 100'000'000ULL };
+
+			/// @brief Parse the first digit_count characters of chunk.  The rest of
+			/// the chunk is shifted out and treated as leading zeros
+			/// @pre 0 < digit_count <= 8 and the first digit_count characters are
+			/// digits
+			[[nodiscard]] DAW_ATTRIB_INLINE constexpr UInt64
+			parse_up_to_8_digits( UInt64 const chunk, std::size_t digit_count ) {
+				return parse_8_digits( chunk << ( 8U * ( 8U - digit_count ) ) );
+			}
+
+			static_assert( parse_up_to_8_digits(
+			                 daw::to_uint64_buffer(
+			                   static_cast<char const *>( "1234,678" ) ),
+			                 4 ) == 1234_u64,
+			               "Partial digit parser does not work on this platform" );
+
 			template<typename T>
 			struct make_unsigned_with_bool : daw::make_unsigned<T> {};
 
@@ -460,6 +522,56 @@ namespace daw::json {
 					  tag, parse_state );
 				}
 			}
+
+			/// @brief Parse an unsigned integer of up to 16 digits by classifying 8
+			/// characters at a time.  Used when parsing arrays of numbers in bulk.
+			/// Falls back to unsigned_parser when there are fewer than 16 characters
+			/// left or more than 16 digits
+			template<typename Unsigned, options::JsonRangeCheck RangeChecked,
+			         typename ParseState>
+			[[nodiscard]] DAW_ATTRIB_INLINE static constexpr Unsigned
+			unsigned_parser_swar( ParseState &parse_state ) {
+				static_assert( daw::is_system_integral_v<Unsigned> and
+				                 std::is_unsigned_v<Unsigned>,
+				               "Only std unsigned integral types are supported" );
+				auto *first = parse_state.first;
+				if( DAW_LIKELY( parse_state.last - first >= 16 ) ) {
+					auto const chunk = daw::to_uint64_buffer( first );
+					std::size_t const digit_count = count_leading_digits_8( chunk );
+					std::uint64_t result = 0;
+					bool is_parsed = false;
+					if( DAW_LIKELY( digit_count - 1U < 7U ) ) {
+						result = static_cast<std::uint64_t>(
+						  parse_up_to_8_digits( chunk, digit_count ) );
+						first += digit_count;
+						is_parsed = true;
+					} else if( digit_count == 8 ) {
+						auto const chunk2 = daw::to_uint64_buffer( first + 8 );
+						std::size_t const digit_count2 = count_leading_digits_8( chunk2 );
+						if( digit_count2 < 8 ) {
+							result = static_cast<std::uint64_t>( parse_8_digits( chunk ) );
+							if( digit_count2 > 0 ) {
+								result *= powers_of_ten_8[digit_count2];
+								result += static_cast<std::uint64_t>(
+								  parse_up_to_8_digits( chunk2, digit_count2 ) );
+							}
+							first += 8 + digit_count2;
+							is_parsed = true;
+						}
+					}
+					if( is_parsed ) {
+						parse_state.first = first;
+						// At most 16 digits, so this fits in 64 bits
+						if constexpr( RangeChecked == options::JsonRangeCheck::Never ) {
+							return static_cast<Unsigned>( result );
+						} else {
+							return narrow_cast<Unsigned>( result, parse_state );
+						}
+					}
+				}
+				return unsigned_parser<Unsigned, RangeChecked, false>(
+				  ParseState::exec_tag, parse_state );
+			}
 		} // namespace json_details
 	} // namespace DAW_JSON_VER
 } // namespace daw::json
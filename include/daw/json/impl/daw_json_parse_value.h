@@ -38,6 +38,7 @@
 #include <daw/stdinc/data_access.h>
 #include <daw/stdinc/tuple_traits.h>
 #include <type_traits>
+#include <vector>
 
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
@@ -468,6 +469,21 @@ namespace daw::json {
 			  can_single_allocation_string_v<json_result_t<JsonMember>> or
 			  can_single_allocation_string_v<json_base_type_t<JsonMember>>;
 
+			/***
+			 * Only string views refer to the decoded bytes when strings are decoded
+			 * in place.  Any other type may own a copy, so the document is left as
+			 * is for them
+			 */
+			template<typename T>
+			inline constexpr bool is_insitu_string_view_v =
+			  std::is_same_v<T, std::string_view> or
+			  std::is_same_v<T, daw::string_view>;
+
+			template<typename JsonMember>
+			inline constexpr bool can_parse_string_insitu_v =
+			  is_insitu_string_view_v<json_result_t<JsonMember>> or
+			  is_insitu_string_view_v<json_base_type_t<JsonMember>>;
+
 			DAW_JSON_MAKE_REQ_TYPE_ALIAS_TRAIT_NT( has_json_member_constructor_v,
 			                                       json_constructor_t<T> );
 
@@ -484,7 +500,22 @@ namespace daw::json {
 					                 ErrorReason::UnexpectedNull );
 				}
 				using constructor_t = json_constructor_t<JsonMember>;
-				if constexpr( can_parse_to_stdstring_fast_v<JsonMember> ) {
+				if constexpr( ParseState::is_insitu_strings and
+				              can_parse_string_insitu_v<JsonMember> ) {
+					// Decode the escapes into the document and refer to it
+					auto parse_state2 =
+					  KnownBounds ? parse_state : skip_string( parse_state );
+					constexpr bool allow_high_eight_bits =
+					  JsonMember::eight_bit_mode != options::EightBitModes::DisallowHigh;
+					char const *last = daw::data_end( parse_state2 );
+					if( not allow_high_eight_bits or needs_slow_path( parse_state2 ) ) {
+						last =
+						  decode_string_insitu<allow_high_eight_bits>( parse_state2 );
+					}
+					return construct_value<json_result_t<JsonMember>, constructor_t>(
+					  parse_state, std::data( parse_state2 ),
+					  static_cast<std::size_t>( last - std::data( parse_state2 ) ) );
+				} else if constexpr( can_parse_to_stdstring_fast_v<JsonMember> ) {
 					using AllowHighEightbits =
 					  std::bool_constant<JsonMember::eight_bit_mode !=
 					                     options::EightBitModes::DisallowHigh>;
@@ -669,6 +700,146 @@ namespace daw::json {
 				  parse_state, iter_t( parse_state ), iter_t( ) );
 			}
 
+			/***
+			 * Can the array be parsed by parse_value_number_array.  The elements must
+			 * be std arithmetic numbers that are never quoted or null, and the
+			 * container a std::vector with the default allocator and constructors
+			 */
+			template<typename JsonMember, typename ParseState>
+			static constexpr bool is_bulk_number_array( ) {
+				using element_t = typename JsonMember::json_element_t;
+				using value_t = json_result_t<element_t>;
+				if constexpr( ParseState::has_allocator ) {
+					return false;
+				} else if constexpr( not std::is_same_v<json_result_t<JsonMember>,
+				                                        std::vector<value_t>> or
+				                     not std::is_same_v<
+				                       json_constructor_t<JsonMember>,
+				                       default_constructor<std::vector<value_t>>> ) {
+					return false;
+				} else if constexpr( element_t::expected_type ==
+				                     JsonParseTypes::Real ) {
+					return element_t::literal_as_string ==
+					         options::LiteralAsStringOpt::Never and
+					       std::is_floating_point_v<value_t> and
+					       std::is_same_v<json_constructor_t<element_t>,
+					                      default_constructor<value_t>>;
+				} else if constexpr( element_t::expected_type ==
+				                       JsonParseTypes::Signed or
+				                     element_t::expected_type ==
+				                       JsonParseTypes::Unsigned ) {
+					return element_t::literal_as_string ==
+					         options::LiteralAsStringOpt::Never and
+					       daw::is_system_integral_v<value_t> and
+					       not std::is_same_v<value_t, bool> and
+					       std::is_same_v<json_constructor_t<element_t>,
+					                      default_constructor<value_t>>;
+				} else {
+					return false;
+				}
+			}
+
+			template<typename JsonMember, typename ParseState>
+			inline constexpr bool is_bulk_number_array_v =
+			  is_bulk_number_array<JsonMember, ParseState>( );
+
+			/// @brief Parse one element of an array of numbers in bulk.  Integers
+			/// are parsed with unsigned_parser_swar, otherwise this matches
+			/// parse_value_signed/unsigned/real
+			template<typename JsonElement, typename ParseState>
+			[[nodiscard]] DAW_ATTRIB_INLINE static constexpr json_result_t<
+			  JsonElement>
+			parse_number_array_element( ParseState &parse_state ) {
+				using value_t = json_result_t<JsonElement>;
+				if constexpr( JsonElement::expected_type == JsonParseTypes::Real ) {
+					return parse_value_real<JsonElement, false>( parse_state );
+				} else if constexpr( JsonElement::expected_type ==
+				                     JsonParseTypes::Signed ) {
+					if constexpr( not ParseState::is_zero_terminated_string ) {
+						daw_json_assert_weak( parse_state.has_more( ),
+						                      ErrorReason::UnexpectedEndOfData,
+						                      parse_state );
+					}
+					auto const sign = static_cast<value_t>(
+					  parse_policy_details::validate_signed_first( parse_state ) );
+					auto const result = static_cast<value_t>( to_signed(
+					  unsigned_parser_swar<std::make_unsigned_t<value_t>,
+					                       JsonElement::range_check>( parse_state ),
+					  sign ) );
+					parse_state.trim_left( );
+					daw_json_assert_weak(
+					  not parse_state.has_more( ) or
+					    parse_policy_details::at_end_of_item( parse_state.front( ) ),
+					  ErrorReason::InvalidEndOfValue, parse_state );
+					return result;
+				} else {
+					if constexpr( not ParseState::is_zero_terminated_string ) {
+						daw_json_assert_weak( parse_state.has_more( ),
+						                      ErrorReason::UnexpectedEndOfData,
+						                      parse_state );
+					}
+					daw_json_assert_weak(
+					  parse_policy_details::is_number( parse_state.front( ) ),
+					  ErrorReason::InvalidNumber, parse_state );
+					auto const result =
+					  unsigned_parser_swar<value_t, JsonElement::range_check>(
+					    parse_state );
+					daw_json_assert_weak(
+					  not parse_state.has_more( ) or
+					    parse_policy_details::at_end_of_item( parse_state.front( ) ),
+					  ErrorReason::InvalidEndOfValue, parse_state );
+					return result;
+				}
+			}
+
+			/***
+			 * Parse an array of numbers directly into a std::vector, without the
+			 * iterator and constructor machinery of parse_value_array
+			 * @pre parse_state is after the opening bracket and whitespace
+			 */
+			template<typename JsonMember, bool KnownBounds, typename ParseState>
+			[[nodiscard]] static constexpr json_result_t<JsonMember>
+			parse_value_number_array( ParseState &parse_state ) {
+				using element_t = typename JsonMember::json_element_t;
+				using value_t = json_result_t<element_t>;
+
+				auto result = json_result_t<JsonMember>( );
+				daw_json_assert_weak( parse_state.has_more( ),
+				                      ErrorReason::UnexpectedEndOfData, parse_state );
+				if( parse_state.front( ) == ']' ) {
+					if constexpr( not KnownBounds ) {
+						parse_state.remove_prefix( );
+						parse_state.trim_left_checked( );
+					}
+					return result;
+				}
+				if constexpr( KnownBounds ) {
+					// Skipping the array counted the commas in it
+					result.reserve( parse_state.counter + 1U );
+				} else {
+					// Same guess as default_constructor<std::vector>, a 4k page
+					result.reserve( 4096U / ( sizeof( value_t ) * 8U ) );
+				}
+				while( true ) {
+					result.push_back(
+					  parse_number_array_element<element_t>( parse_state ) );
+					parse_state.trim_left( );
+					daw_json_assert_weak( parse_state.has_more( ) and
+					                        parse_state.is_at_next_array_element( ),
+					                      ErrorReason::UnexpectedEndOfData, parse_state );
+					parse_state.move_next_member_or_end( );
+					daw_json_assert_weak( parse_state.has_more( ),
+					                      ErrorReason::UnexpectedEndOfData, parse_state );
+					if( parse_state.front( ) == ']' ) {
+						if constexpr( not KnownBounds ) {
+							parse_state.remove_prefix( );
+							parse_state.trim_left_checked( );
+						}
+						return result;
+					}
+				}
+			}
+
 			template<typename JsonMember, bool KnownBounds, typename ParseState>
 			[[nodiscard]] static constexpr json_result_t<JsonMember>
 			parse_value_array( ParseState &parse_state ) {
@@ -677,15 +848,20 @@ namespace daw::json {
 				                      ErrorReason::InvalidArrayStart, parse_state );
 				parse_state.remove_prefix( );
 				parse_state.trim_left_unchecked( );
-				// TODO: add parse option to disable random access iterators. This is
-				// coding to the implementations
+				if constexpr( is_bulk_number_array_v<JsonMember, ParseState> ) {
+					return parse_value_number_array<JsonMember, KnownBounds>(
+					  parse_state );
+				} else {
+					// TODO: add parse option to disable random access iterators. This
+					// is coding to the implementations
 
-				using iterator_t =
-				  json_parse_array_iterator<JsonMember, ParseState,
-				                            can_be_random_iterator_v<KnownBounds>>;
-				using constructor_t = json_constructor_t<JsonMember>;
-				return construct_value<json_result_t<JsonMember>, constructor_t>(
-				  parse_state, iterator_t( parse_state ), iterator_t( ) );
+					using iterator_t =
+					  json_parse_array_iterator<JsonMember, ParseState,
+					                            can_be_random_iterator_v<KnownBounds>>;
+					using constructor_t = json_constructor_t<JsonMember>;
+					return construct_value<json_result_t<JsonMember>, constructor_t>(
+					  parse_state, iterator_t( parse_state ), iterator_t( ) );
+				}
 			}
 
 			template<typename JsonMember, bool KnownBounds, typename ParseState>
@@ -827,9 +1003,10 @@ namespace daw::json {
 				using class_wrapper_t = typename JsonMember::tag_member_class_wrapper;
 
 				using switcher_t = typename JsonMember::switcher;
-				auto parse_state2 =
+				// The class is parsed again once the tag is known
+				auto parse_state2 = without_insitu_strings(
 				  ParseState( parse_state.class_first, parse_state.class_last,
-				              parse_state.class_first, parse_state.class_last );
+				              parse_state.class_first, parse_state.class_last ) );
 				if constexpr( is_an_ordered_member_v<tag_member> ) {
 					// This is an ordered class, class must start with '['
 					daw_json_assert_weak( parse_state2.is_opening_bracket_checked( ),
@@ -864,7 +1041,8 @@ namespace daw::json {
 					using tag_submember = typename JsonMember::tag_submember;
 					using class_wrapper_t =
 					  typename JsonMember::tag_submember_class_wrapper;
-					auto parse_state2 = parse_state;
+					// The class is parsed again once the tag is known
+					auto parse_state2 = without_insitu_strings( parse_state );
 					using switcher_t = typename JsonMember::switcher;
 					if constexpr( is_an_ordered_member_v<tag_submember> ) {
 						return switcher_t{ }( std::get<0>(
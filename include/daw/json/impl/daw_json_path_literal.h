@@ -0,0 +1,233 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include "daw_json_assert.h"
+#include "daw_json_name.h"
+#include "daw_json_parse_name.h"
+#include "daw_json_skip.h"
+
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			/// @brief A member name or array index of a path parsed at compile
+			/// time
+			struct json_path_segment {
+				std::size_t name_first = 0;
+				std::size_t name_size = 0;
+				std::size_t index = 0;
+				/// The segment selects a class member
+				bool is_member = false;
+				/// The segment selects an array element.  A JSON Pointer segment
+				/// of digits can select either
+				bool is_index = false;
+			};
+
+			/// @brief The segments of a path with N characters, which has at most N
+			/// segments and N characters of names
+			template<std::size_t N>
+			struct parsed_json_path {
+				json_path_segment segments[N + 1]{ };
+				char names[N + 1]{ };
+				std::size_t size = 0;
+
+				[[nodiscard]] constexpr daw::string_view
+				name( json_path_segment const &segment ) const {
+					return daw::string_view( names + segment.name_first,
+					                         segment.name_size );
+				}
+			};
+
+			/// @brief Parse a member path, e.g. a.b[3].c, where a \ escapes the
+			/// character after it in a name
+			template<std::size_t N>
+			[[nodiscard]] constexpr parsed_json_path<N>
+			parse_json_path_literal( daw::string_view path ) {
+				auto result = parsed_json_path<N>{ };
+				std::size_t name_pos = 0;
+				std::size_t pos = 0;
+				while( pos < path.size( ) ) {
+					if( path[pos] == '.' ) {
+						++pos;
+						continue;
+					}
+					auto &segment = result.segments[result.size++];
+					if( path[pos] == '[' ) {
+						++pos;
+						daw_json_ensure( pos < path.size( ) and path[pos] != ']',
+						                 ErrorReason::InvalidJSONPath );
+						while( pos < path.size( ) and path[pos] != ']' ) {
+							daw_json_ensure( path[pos] >= '0' and path[pos] <= '9',
+							                 ErrorReason::InvalidJSONPath );
+							segment.index = segment.index * 10U +
+							                static_cast<std::size_t>( path[pos] - '0' );
+							++pos;
+						}
+						daw_json_ensure( pos < path.size( ), ErrorReason::InvalidJSONPath );
+						++pos;
+						segment.is_index = true;
+						continue;
+					}
+					segment.is_member = true;
+					segment.name_first = name_pos;
+					while( pos < path.size( ) and path[pos] != '.' and
+					       path[pos] != '[' ) {
+						if( path[pos] == '\\' and pos + 1 < path.size( ) ) {
+							++pos;
+						}
+						result.names[name_pos++] = path[pos++];
+					}
+					segment.name_size = name_pos - segment.name_first;
+				}
+				return result;
+			}
+
+			/// @brief Parse an RFC 6901 JSON Pointer, e.g. /a/b/3/c, where ~0 is
+			/// a ~ and ~1 is a / in a name.  The empty pointer is the whole
+			/// document
+			template<std::size_t N>
+			[[nodiscard]] constexpr parsed_json_path<N>
+			parse_json_pointer_literal( daw::string_view pointer ) {
+				auto result = parsed_json_path<N>{ };
+				std::size_t name_pos = 0;
+				std::size_t pos = 0;
+				while( pos < pointer.size( ) ) {
+					daw_json_ensure( pointer[pos] == '/', ErrorReason::InvalidJSONPath );
+					++pos;
+					auto &segment = result.segments[result.size++];
+					segment.is_member = true;
+					segment.name_first = name_pos;
+					bool is_digits = pos < pointer.size( ) and pointer[pos] != '/';
+					while( pos < pointer.size( ) and pointer[pos] != '/' ) {
+						char c = pointer[pos++];
+						if( c == '~' ) {
+							daw_json_ensure( pos < pointer.size( ) and
+							                   ( pointer[pos] == '0' or pointer[pos] == '1' ),
+							                 ErrorReason::InvalidJSONPath );
+							c = pointer[pos++] == '0' ? '~' : '/';
+						}
+						if( c >= '0' and c <= '9' ) {
+							segment.index =
+							  segment.index * 10U + static_cast<std::size_t>( c - '0' );
+						} else {
+							is_digits = false;
+						}
+						result.names[name_pos++] = c;
+					}
+					segment.name_size = name_pos - segment.name_first;
+					// Leading zeros are not array indices
+					segment.is_index =
+					  is_digits and ( segment.name_size == 1 or
+					                  result.names[segment.name_first] != '0' );
+				}
+				return result;
+			}
+
+			/// @brief Move parse_state to the value at path
+			/// @return false when the path is not in the document
+			template<typename ParseState, std::size_t N>
+			[[nodiscard]] constexpr bool
+			find_json_path_literal( ParseState &parse_state,
+			                        parsed_json_path<N> const &path ) {
+				for( std::size_t n = 0; n < path.size; ++n ) {
+					auto const &segment = path.segments[n];
+					parse_state.trim_left( );
+					if( not parse_state.has_more( ) ) {
+						return false;
+					}
+					if( parse_state.front( ) == '[' ) {
+						if( not segment.is_index ) {
+							return false;
+						}
+						parse_state.remove_prefix( );
+						parse_state.trim_left( );
+						for( std::size_t idx = segment.index; idx > 0; --idx ) {
+							if( not parse_state.has_more( ) or parse_state.front( ) == ']' ) {
+								return false;
+							}
+							(void)skip_value( parse_state );
+							parse_state.move_next_member_or_end( );
+						}
+						if( not parse_state.has_more( ) or parse_state.front( ) == ']' ) {
+							return false;
+						}
+					} else if( parse_state.front( ) == '{' ) {
+						if( not segment.is_member ) {
+							return false;
+						}
+						parse_state.remove_prefix( );
+						parse_state.trim_left( );
+						auto const expected = path.name( segment );
+						while( true ) {
+							if( not parse_state.is_quotes_checked( ) ) {
+								return false;
+							}
+							auto const name = parse_name( parse_state );
+							// The size rules out most names before the bytes are compared
+							if( name.size( ) == expected.size( ) and name == expected ) {
+								break;
+							}
+							(void)skip_value( parse_state );
+							parse_state.move_next_member_or_end( );
+						}
+					} else {
+						return false;
+					}
+				}
+				parse_state.trim_left( );
+				return true;
+			}
+		} // namespace json_details
+
+		/***
+		 * A member path parsed at compile time, e.g.
+		 * json_path<"a.b[3].c">.  Pass it where a member path string is
+		 * accepted, to from_json, json_apply, and basic_json_value::find_member,
+		 * and the lookup compares the member names and indices without
+		 * parsing the path.  Without C++20 class template arguments, pass a
+		 * static constexpr char const array
+		 */
+		template<JSONNAMETYPE Path>
+		struct json_path {
+			static constexpr daw::string_view path = Path;
+			static constexpr auto parsed =
+			  json_details::parse_json_path_literal<path.size( )>( path );
+		};
+
+		/***
+		 * An RFC 6901 JSON Pointer parsed at compile time, e.g.
+		 * json_pointer<"/a/b/3/c">.  It is used like json_path.  A segment of
+		 * digits selects an array element, or a member of that name in a class
+		 */
+		template<JSONNAMETYPE Pointer>
+		struct json_pointer {
+			static constexpr daw::string_view path = Pointer;
+			static constexpr auto parsed =
+			  json_details::parse_json_pointer_literal<path.size( )>( path );
+		};
+
+		namespace json_details {
+			template<typename>
+			inline constexpr bool is_json_path_literal_v = false;
+
+			template<JSONNAMETYPE Path>
+			inline constexpr bool is_json_path_literal_v<json_path<Path>> = true;
+
+			template<JSONNAMETYPE Pointer>
+			inline constexpr bool is_json_path_literal_v<json_pointer<Pointer>> =
+			  true;
+		} // namespace json_details
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -0,0 +1,435 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include "daw_json_exec_modes.h"
+#include "daw_not_const_ex_functions.h"
+
+#include <daw/daw_attributes.h>
+
+#if defined( DAW_HAS_MSVC_LIKE )
+#include <intrin.h>
+#endif
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			DAW_ATTRIB_INLINE std::size_t
+			structural_count_trailing_zeros( std::uint64_t value ) {
+#if DAW_HAS_BUILTIN( __builtin_ctzll )
+				return static_cast<std::size_t>(
+				  __builtin_ctzll( static_cast<unsigned long long>( value ) ) );
+#elif defined( DAW_HAS_MSVC_LIKE ) and defined( _M_X64 )
+				unsigned long index;
+				_BitScanForward64( &index, value );
+				return static_cast<std::size_t>( index );
+#else
+				std::size_t result = 0;
+				while( ( value & 1U ) == 0 ) {
+					value >>= 1U;
+					++result;
+				}
+				return result;
+#endif
+			}
+
+			/// @brief Stage one of a two stage parse.  A single pass over the whole
+			/// document records where each array and class closes and how many
+			/// elements it directly holds.  Skipping a value the mapping does not
+			/// need then becomes a lookup instead of a rescan of its bytes.
+			/// @note Only documents smaller than 4GB are indexed, and an index
+			/// for a document with mismatched brackets is left empty.  The parser
+			/// falls back to scanning when a bracket is not in the index
+			class structural_index {
+			public:
+				struct entry {
+					/// Offset of the opening bracket
+					std::uint32_t open;
+					/// Offset one past the closing bracket, zero when it is never
+					/// closed
+					std::uint32_t close;
+					/// The number of commas directly inside the brackets
+					std::uint32_t count;
+					/// Index of the first entry after the closing bracket
+					std::uint32_t next;
+				};
+
+			private:
+				char const *m_first = nullptr;
+				std::size_t m_size = 0;
+				std::vector<entry> m_entries{ };
+				std::vector<std::uint32_t> m_open_stack{ };
+				bool m_is_valid = true;
+
+			public:
+				structural_index( ) = default;
+
+				template<typename ExecTag>
+				structural_index( ExecTag tag, char const *first, char const *last )
+				  : m_first( first )
+				  , m_size( static_cast<std::size_t>( last - first ) ) {
+					if( m_size >=
+					    ( std::numeric_limits<std::uint32_t>::max )( ) ) {
+						m_is_valid = false;
+						return;
+					}
+					build_structural_index( tag, first, last, *this );
+					m_open_stack = std::vector<std::uint32_t>( );
+					if( not m_is_valid ) {
+						m_entries = std::vector<entry>( );
+					}
+				}
+
+				/// @brief Record a bracket, brace, or comma that is not inside a
+				/// string.  Must be called in document order
+				inline void add_structural( char const *pos ) {
+					auto const offset = static_cast<std::uint32_t>( pos - m_first );
+					switch( *pos ) {
+					case '{':
+					case '[':
+						m_open_stack.push_back(
+						  static_cast<std::uint32_t>( m_entries.size( ) ) );
+						m_entries.push_back( entry{ offset, 0, 0, 0 } );
+						break;
+					case '}':
+					case ']': {
+						if( m_open_stack.empty( ) ) {
+							m_is_valid = false;
+							return;
+						}
+						entry &e = m_entries[m_open_stack.back( )];
+						if( ( m_first[e.open] == '{' ) != ( *pos == '}' ) ) {
+							m_is_valid = false;
+							return;
+						}
+						e.close = offset + 1U;
+						e.next = static_cast<std::uint32_t>( m_entries.size( ) );
+						m_open_stack.pop_back( );
+						break;
+					}
+					case ',':
+						if( not m_open_stack.empty( ) ) {
+							++m_entries[m_open_stack.back( )].count;
+						}
+						break;
+					}
+				}
+
+				/// @brief Record each set bit of structurals as a position relative
+				/// to block
+				inline void add_structurals( char const *block,
+				                             std::uint64_t structurals ) {
+					while( structurals != 0 ) {
+						add_structural(
+						  block + structural_count_trailing_zeros( structurals ) );
+						structurals &= structurals - 1U;
+					}
+				}
+
+				/// @brief Find the entry for the opening bracket at open, starting
+				/// the search at cursor.  The parser moves forward through the
+				/// document, so the entry is almost always at or just after the
+				/// cursor.  Afterwards cursor is the first entry after the one
+				/// found, or after open when there is none
+				/// @return The entry or nullptr if open is not an indexed bracket that
+				/// is closed
+				[[nodiscard]] inline entry const *find( char const *open,
+				                                        std::size_t &cursor ) const {
+					// Pointers into another buffer cannot be compared with m_first, the
+					// unsigned offset of one before it wraps past m_size
+					auto const offset = static_cast<std::size_t>(
+					  reinterpret_cast<std::uintptr_t>( open ) -
+					  reinterpret_cast<std::uintptr_t>( m_first ) );
+					if( m_entries.empty( ) or offset >= m_size ) {
+						return nullptr;
+					}
+					auto const open_before = [&]( entry const &e, std::size_t o ) {
+						return e.open < o;
+					};
+					std::size_t pos = ( std::min )( cursor, m_entries.size( ) );
+					if( pos > 0 and m_entries[pos - 1U].open >= offset ) {
+						// Behind the cursor, e.g. a class that is parsed again
+						pos = static_cast<std::size_t>(
+						  std::lower_bound( m_entries.begin( ),
+						                    m_entries.begin( ) +
+						                      static_cast<std::ptrdiff_t>( pos ),
+						                    offset, open_before ) -
+						  m_entries.begin( ) );
+					} else {
+						// Brackets the parser did not skip are walked over one at a time,
+						// a binary search takes over when the cursor is far behind
+						std::size_t const near_last =
+						  ( std::min )( pos + 8U, m_entries.size( ) );
+						while( pos < near_last and m_entries[pos].open < offset ) {
+							++pos;
+						}
+						if( pos == near_last and pos < m_entries.size( ) and
+						    m_entries[pos].open < offset ) {
+							pos = static_cast<std::size_t>(
+							  std::lower_bound( m_entries.begin( ) +
+							                      static_cast<std::ptrdiff_t>( pos ),
+							                    m_entries.end( ), offset, open_before ) -
+							  m_entries.begin( ) );
+						}
+					}
+					if( pos == m_entries.size( ) or m_entries[pos].open != offset or
+					    m_entries[pos].close == 0 ) {
+						cursor = pos;
+						return nullptr;
+					}
+					cursor = m_entries[pos].next;
+					return &m_entries[pos];
+				}
+
+				/// @brief Find the entry for the opening bracket at open
+				/// @return The entry or nullptr if open is not an indexed bracket that
+				/// is closed
+				[[nodiscard]] inline entry const *find( char const *open ) const {
+					std::size_t cursor = 0;
+					return find( open, cursor );
+				}
+
+				[[nodiscard]] inline char const *data( ) const {
+					return m_first;
+				}
+
+				[[nodiscard]] inline std::size_t size( ) const {
+					return m_entries.size( );
+				}
+
+				[[nodiscard]] inline bool is_valid( ) const {
+					return m_is_valid;
+				}
+
+				[[nodiscard]] inline bool empty( ) const {
+					return m_entries.empty( );
+				}
+			};
+
+			/// @brief Placeholder for when the parse policy does not use a
+			/// structural index
+			struct no_structural_index {};
+
+			/// @brief Byte at a time stage one, used when no SIMD kernels are
+			/// available
+			inline void build_structural_index( constexpr_exec_tag, char const *first,
+			                                    char const *const last,
+			                                    structural_index &index ) {
+				bool in_string = false;
+				while( first < last ) {
+					char const c = *first;
+					if( in_string ) {
+						if( c == '\\' ) {
+							++first;
+						} else if( c == '"' ) {
+							in_string = false;
+						}
+					} else {
+						switch( c ) {
+						case '\\':
+							++first;
+							break;
+						case '"':
+							in_string = true;
+							break;
+						case '{':
+						case '}':
+						case '[':
+						case ']':
+						case ',':
+							index.add_structural( first );
+							break;
+						}
+					}
+					++first;
+				}
+			}
+
+#if defined( DAW_JSON_HAS_SSE42_KERNELS )
+			DAW_JSON_TARGET_SSE42 inline void
+			build_structural_index( sse42_exec_tag tag, char const *first,
+			                        char const *const last,
+			                        structural_index &index ) {
+				UInt32 prev_escaped = 0_u32;
+				UInt32 prev_in_string = 0_u32;
+				while( last - first >= 16 ) {
+					index.add_structurals(
+					  first, static_cast<std::uint64_t>( find_structurals(
+					           tag, first, prev_escaped, prev_in_string ) ) );
+					first += 16;
+				}
+				if( first < last ) {
+					// Pad the tail with whitespace so the block can be read whole
+					char tail[16];
+					std::memset( tail, ' ', sizeof( tail ) );
+					std::memcpy( tail, first, static_cast<std::size_t>( last - first ) );
+					index.add_structurals(
+					  first, static_cast<std::uint64_t>( find_structurals(
+					           tag, tail, prev_escaped, prev_in_string ) ) );
+				}
+			}
+#endif
+#if defined( DAW_JSON_HAS_AVX2_KERNELS )
+			DAW_JSON_TARGET_AVX2 inline void
+			build_structural_index( avx2_exec_tag tag, char const *first,
+			                        char const *const last,
+			                        structural_index &index ) {
+				UInt32 prev_escaped = 0_u32;
+				UInt32 prev_in_string = 0_u32;
+				while( last - first >= 32 ) {
+					index.add_structurals(
+					  first, static_cast<std::uint64_t>( find_structurals(
+					           tag, first, prev_escaped, prev_in_string ) ) );
+					first += 32;
+				}
+				if( first < last ) {
+					char tail[32];
+					std::memset( tail, ' ', sizeof( tail ) );
+					std::memcpy( tail, first, static_cast<std::size_t>( last - first ) );
+					index.add_structurals(
+					  first, static_cast<std::uint64_t>( find_structurals(
+					           tag, tail, prev_escaped, prev_in_string ) ) );
+				}
+			}
+#endif
+#if defined( DAW_JSON_HAS_AVX512_KERNELS )
+			DAW_JSON_TARGET_AVX512 inline void
+			build_structural_index( avx512_exec_tag tag, char const *first,
+			                        char const *const last,
+			                        structural_index &index ) {
+				UInt64 prev_escaped = 0_u64;
+				UInt64 prev_in_string = 0_u64;
+				while( last - first >= 64 ) {
+					index.add_structurals(
+					  first, static_cast<std::uint64_t>( find_structurals(
+					           tag, first, prev_escaped, prev_in_string ) ) );
+					first += 64;
+				}
+				if( first < last ) {
+					char tail[64];
+					std::memset( tail, ' ', sizeof( tail ) );
+					std::memcpy( tail, first, static_cast<std::size_t>( last - first ) );
+					index.add_structurals(
+					  first, static_cast<std::uint64_t>( find_structurals(
+					           tag, tail, prev_escaped, prev_in_string ) ) );
+				}
+			}
+#endif
+#if defined( DAW_JSON_CPU_DISPATCH )
+			namespace cpu_dispatch {
+				struct structural_index_kernels
+				  : kernel_table<structural_index_kernels, void, char const *,
+				                 char const *, structural_index &> {
+
+					static void generic( char const *first, char const *last,
+					                     structural_index &index ) {
+						build_structural_index( constexpr_exec_tag{ }, first, last,
+						                        index );
+					}
+
+					static void sse42( char const *first, char const *last,
+					                   structural_index &index ) {
+						build_structural_index( sse42_exec_tag{ }, first, last, index );
+					}
+
+					static void avx2( char const *first, char const *last,
+					                  structural_index &index ) {
+						build_structural_index( avx2_exec_tag{ }, first, last, index );
+					}
+
+					static void avx512( char const *first, char const *last,
+					                    structural_index &index ) {
+						build_structural_index( avx512_exec_tag{ }, first, last, index );
+					}
+				};
+			} // namespace cpu_dispatch
+
+			inline void build_structural_index( cpu_dispatch_exec_tag,
+			                                    char const *first,
+			                                    char const *last,
+			                                    structural_index &index ) {
+				cpu_dispatch::structural_index_kernels::call( first, last, index );
+			}
+#endif
+
+			/// @brief Holds the structural index a parse state walks, when the
+			/// policy asks for one.  The index is owned by the caller of from_json
+			/// and must outlive the parse states pointing at it
+			template<bool UseStructuralIndex>
+			struct StructuralIndexWrapper {
+				[[nodiscard]] DAW_ATTRIB_INLINE constexpr structural_index const *
+				get_structural_index( ) const {
+					return nullptr;
+				}
+
+				template<typename Index>
+				DAW_ATTRIB_INLINE constexpr void
+				set_structural_index( Index const & ) {}
+			};
+
+			template<>
+			struct StructuralIndexWrapper<true> {
+				structural_index const *m_structural_index = nullptr;
+				/// Where the next structural_index::find starts.  Copies of the
+				/// parse state carry it along, it is only a hint
+				std::size_t m_structural_cursor = 0;
+
+				[[nodiscard]] DAW_ATTRIB_INLINE constexpr structural_index const *
+				get_structural_index( ) const {
+					return m_structural_index;
+				}
+
+				[[nodiscard]] DAW_ATTRIB_INLINE constexpr std::size_t &
+				structural_cursor( ) {
+					return m_structural_cursor;
+				}
+
+				DAW_ATTRIB_INLINE constexpr void
+				set_structural_index( structural_index const &index ) {
+					m_structural_index = &index;
+					m_structural_cursor = 0;
+				}
+
+				DAW_ATTRIB_INLINE constexpr void
+				set_structural_index( structural_index const *index ) {
+					m_structural_index = index;
+					m_structural_cursor = 0;
+				}
+
+				DAW_ATTRIB_INLINE constexpr void
+				set_structural_index( std::nullptr_t ) {
+					m_structural_index = nullptr;
+					m_structural_cursor = 0;
+				}
+			};
+
+			/// @brief Run stage one over the document when ParseState uses a
+			/// structural index, otherwise return an empty placeholder
+			template<typename ParseState>
+			constexpr auto make_structural_index( char const *first,
+			                                      char const *last ) {
+				if constexpr( ParseState::use_structural_index ) {
+					return structural_index( ParseState::exec_tag, first, last );
+				} else {
+					(void)first;
+					(void)last;
+					return no_structural_index{ };
+				}
+			}
+		} // namespace json_details
+	}   // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -114,10 +114,41 @@ namespace daw::json {
 			  options::FPOutputFormat::Auto;
 		} // namespace json_details
 
+		namespace options {
+			/// @brief Output floating point numbers with a fixed number of
+			/// fractional digits, rounded, instead of the shortest form that round
+			/// trips.  Select the digits with fixed_decimals<N>
+			enum class FPFixedDecimals : unsigned {
+				/// Output the shortest form that parses back to the same value
+				Shortest
+			};
+
+			/// @brief Output floating point numbers with Decimals fractional
+			/// digits, e.g. number_opt( fixed_decimals<2> ) outputs 1.5 as 1.50
+			template<unsigned Decimals>
+			inline constexpr FPFixedDecimals fixed_decimals = [] {
+				static_assert( Decimals <= 18U,
+				               "At most 18 fractional digits are supported" );
+				return static_cast<FPFixedDecimals>( Decimals + 1U );
+			}( );
+		} // namespace options
+
+		namespace json_details {
+			template<>
+			inline constexpr unsigned
+			  json_option_bits_width<options::FPFixedDecimals> = 5;
+
+			template<>
+			inline constexpr auto
+			  default_json_option_value<options::FPFixedDecimals> =
+			    options::FPFixedDecimals::Shortest;
+		} // namespace json_details
+
 		// json_number
 		using number_opts_t = json_details::JsonOptionList<
 		  options::LiteralAsStringOpt, options::JsonRangeCheck,
-		  options::JsonNumberErrors, options::FPOutputFormat>;
+		  options::JsonNumberErrors, options::FPOutputFormat,
+		  options::FPFixedDecimals>;
 
 		inline constexpr auto number_opts = number_opts_t{ };
 		inline constexpr json_options_t number_opts_def =
@@ -16,6 +16,7 @@
 #include "daw_json_parse_policy.h"
 #include "daw_json_parse_unsigned_int.h"
 #include "daw_json_parse_value_fwd.h"
+#include "daw_json_path_literal.h"
 #include "daw_json_skip.h"
 #include "daw_json_traits.h"
 #include "daw_json_value_fwd.h"
@@ -38,8 +39,8 @@ namespace daw::json {
 		template<json_options_t PolicyFlags = json_details::default_policy_flag,
 		         typename Allocator = json_details::NoAllocator>
 		struct basic_json_pair {
-			using ParseState =
-			  TryDefaultParsePolicy<BasicParsePolicy<PolicyFlags, Allocator>>;
+			using ParseState = json_details::no_insitu_strings_policy_t<
+			  TryDefaultParsePolicy<BasicParsePolicy<PolicyFlags, Allocator>>>;
 
 			std::optional<std::string_view> name;
 			basic_json_value<PolicyFlags, Allocator> value;
@@ -121,8 +122,8 @@ namespace daw::json {
 			using pointer = json_details::arrow_proxy<value_type>;
 			using difference_type = std::ptrdiff_t;
 			using iterator_category = std::forward_iterator_tag;
-			using parse_policy =
-			  TryDefaultParsePolicy<BasicParsePolicy<PolicyFlags, Allocator>>;
+			using parse_policy = json_details::no_insitu_strings_policy_t<
+			  TryDefaultParsePolicy<BasicParsePolicy<PolicyFlags, Allocator>>>;
 
 		private:
 			using ParseState = parse_policy;
@@ -346,8 +347,8 @@ namespace daw::json {
 		/// @tparam ParseState see IteratorRange
 		template<json_options_t PolicyFlags, typename Allocator>
 		struct basic_json_value {
-			using ParseState =
-			  TryDefaultParsePolicy<BasicParsePolicy<PolicyFlags, Allocator>>;
+			using ParseState = json_details::no_insitu_strings_policy_t<
+			  TryDefaultParsePolicy<BasicParsePolicy<PolicyFlags, Allocator>>>;
 			ParseState m_parse_state{ };
 			using CharT = typename ParseState::CharT;
 			using iterator = basic_json_value_iterator<PolicyFlags, Allocator>;
@@ -363,6 +364,9 @@ namespace daw::json {
 			explicit inline constexpr basic_json_value(
 			  BasicParsePolicy<P, A> parse_state )
 			  : m_parse_state( std::move( parse_state ) ) {
+				// A json_value can outlive the from_json call that owns the
+				// structural index
+				m_parse_state.set_structural_index( nullptr );
 				// Ensure we are at the actual value.
 				m_parse_state.trim_left( );
 			}
@@ -498,6 +502,20 @@ namespace daw::json {
 				return jv;
 			}
 
+			/// @brief find a class member/array element as specified by a
+			/// json_path or json_pointer that was parsed at compile time
+			template<typename Path DAW_JSON_ENABLEIF(
+			  json_details::is_json_path_literal_v<Path> )>
+			DAW_JSON_REQUIRES( json_details::is_json_path_literal_v<Path> )
+			[[nodiscard]] constexpr basic_json_value find_member( Path ) const {
+				auto parse_state = m_parse_state;
+				if( not json_details::find_json_path_literal( parse_state,
+				                                              Path::parsed ) ) {
+					return basic_json_value( );
+				}
+				return basic_json_value( parse_state );
+			}
+
 			/// @brief Parse the current json member as a Result.  The Result type
 			/// must be supported or mapped via a json_data_contract
 			template<typename Result>
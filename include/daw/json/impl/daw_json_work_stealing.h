@@ -0,0 +1,155 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			/// @brief The number of threads to use when the caller does not say
+			inline std::size_t default_thread_count( ) {
+				auto const result =
+				  static_cast<std::size_t>( std::thread::hardware_concurrency( ) );
+				return result == 0 ? 1 : result;
+			}
+
+			/// @brief The task indices a worker has left to run.  The owner takes
+			/// from the front and thieves take the back half, so each worker runs
+			/// mostly contiguous tasks
+			class work_stealing_range {
+				std::mutex m_mutex{ };
+				std::size_t m_first = 0;
+				std::size_t m_last = 0;
+
+			public:
+				work_stealing_range( ) = default;
+
+				void assign( std::size_t first, std::size_t last ) {
+					auto const lck = std::lock_guard<std::mutex>( m_mutex );
+					m_first = first;
+					m_last = last;
+				}
+
+				[[nodiscard]] bool pop_front( std::size_t &task_index ) {
+					auto const lck = std::lock_guard<std::mutex>( m_mutex );
+					if( m_first == m_last ) {
+						return false;
+					}
+					task_index = m_first++;
+					return true;
+				}
+
+				/// @brief Remove the back half of the remaining tasks, rounded up
+				/// @return false when there was nothing to take
+				[[nodiscard]] bool steal_back_half( std::size_t &first,
+				                                    std::size_t &last ) {
+					auto const lck = std::lock_guard<std::mutex>( m_mutex );
+					auto const remaining = m_last - m_first;
+					if( remaining == 0 ) {
+						return false;
+					}
+					last = m_last;
+					m_last -= ( remaining + 1U ) / 2U;
+					first = m_last;
+					return true;
+				}
+			};
+
+			/***
+			 * Run task( worker_index, task_index ) for every task_index in
+			 * [0, task_count) on up to thread_count threads, the calling thread
+			 * being worker 0.  The tasks start split evenly into contiguous ranges,
+			 * one per worker, and a worker that runs out steals half of what another
+			 * has left.  Once a task throws no new tasks are started and the first
+			 * exception is rethrown after all workers have stopped.
+			 */
+			template<typename Task>
+			void run_work_stealing( std::size_t thread_count, std::size_t task_count,
+			                        Task &&task ) {
+				if( thread_count > task_count ) {
+					thread_count = task_count;
+				}
+				if( thread_count <= 1 ) {
+					for( std::size_t n = 0; n < task_count; ++n ) {
+						task( std::size_t{ 0 }, n );
+					}
+					return;
+				}
+				auto ranges = std::vector<work_stealing_range>( thread_count );
+				for( std::size_t w = 0; w < thread_count; ++w ) {
+					ranges[w].assign( task_count * w / thread_count,
+					                  task_count * ( w + 1 ) / thread_count );
+				}
+				std::atomic<bool> has_error = false;
+				std::exception_ptr first_error{ };
+				std::mutex error_mutex{ };
+
+				auto const worker = [&]( std::size_t worker_index ) {
+					auto &own = ranges[worker_index];
+					std::size_t task_index = 0;
+					while( not has_error.load( std::memory_order_relaxed ) ) {
+						if( not own.pop_front( task_index ) ) {
+							bool has_stolen = false;
+							for( std::size_t n = 1; n < thread_count and not has_stolen;
+							     ++n ) {
+								auto &victim = ranges[( worker_index + n ) % thread_count];
+								std::size_t first = 0;
+								std::size_t last = 0;
+								if( victim.steal_back_half( first, last ) ) {
+									own.assign( first, last );
+									has_stolen = true;
+								}
+							}
+							if( not has_stolen ) {
+								// Tasks are never added, so once every range is empty
+								// there is nothing left to do
+								return;
+							}
+							continue;
+						}
+#if defined( DAW_USE_EXCEPTIONS )
+						try {
+#endif
+							task( worker_index, task_index );
+#if defined( DAW_USE_EXCEPTIONS )
+						} catch( ... ) {
+							auto const lck = std::lock_guard<std::mutex>( error_mutex );
+							if( not first_error ) {
+								first_error = std::current_exception( );
+							}
+							has_error.store( true, std::memory_order_relaxed );
+						}
+#endif
+					}
+				};
+
+				auto threads = std::vector<std::thread>( );
+				threads.reserve( thread_count - 1 );
+				for( std::size_t w = 1; w < thread_count; ++w ) {
+					threads.emplace_back( worker, w );
+				}
+				worker( 0 );
+				for( auto &t : threads ) {
+					t.join( );
+				}
+				if( first_error ) {
+					std::rethrow_exception( first_error );
+				}
+			}
+		} // namespace json_details
+	}   // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -11,6 +11,7 @@
 #include "version.h"
 
 #include "daw_json_assert.h"
+#include "daw_json_cpu_dispatch.h"
 #include "daw_json_exec_modes.h"
 
 #include <daw/daw_attributes.h>
@@ -21,7 +22,7 @@
 #include <daw/daw_uint_buffer.h>
 #include <daw/daw_unreachable.h>
 
-#if defined( DAW_ALLOW_SSE42 )
+#if defined( DAW_JSON_HAS_SSE42_KERNELS )
 #include <emmintrin.h>
 #include <nmmintrin.h>
 #include <smmintrin.h>
@@ -32,9 +33,17 @@
 #include <intrin.h>
 #endif
 #endif
+#if defined( DAW_JSON_HAS_AVX2_KERNELS )
+#include <immintrin.h>
+#endif
 
+#if defined( DAW_JSON_CPU_DISPATCH )
+#include <atomic>
+#endif
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
+#include <type_traits>
 
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
@@ -50,7 +59,74 @@ namespace daw::json {
 				return *( ptr - 2 ) != '\\';
 			}
 
-#if defined( DAW_ALLOW_SSE42 )
+			/// @brief Skip JSON whitespace, and any other control character, in
+			/// [first, last).  A zero terminator is never skipped
+			template<typename CharT>
+			DAW_ATTRIB_INLINE constexpr CharT *
+			mem_skip_whitespace( constexpr_exec_tag, CharT *first,
+			                     CharT *const last ) {
+				while( DAW_LIKELY( first < last ) and
+				       ( static_cast<unsigned>( static_cast<unsigned char>( *first ) ) -
+				         1U ) <= 0x1FU ) {
+					++first;
+				}
+				return first;
+			}
+
+			/// @brief Find the first byte in [first, last) that cannot be copied
+			/// into a JSON string as is: a quote, a backslash, or a control
+			/// character.
+			/// @tparam restrict_high Also stop at bytes of 0x7F and up, for output
+			/// that escapes or checks them
+			template<bool restrict_high, typename CharT>
+			DAW_ATTRIB_INLINE constexpr CharT *
+			mem_find_string_escape( constexpr_exec_tag, CharT *first,
+			                        CharT *const last ) {
+				while( first < last ) {
+					auto const c =
+					  static_cast<unsigned>( static_cast<unsigned char>( *first ) );
+					// Printable ASCII, 0x20-0x7E, moves to 0x00-0x5E
+					bool const is_clean =
+					  restrict_high ? ( c - 0x20U ) <= 0x5EU : c >= 0x20U;
+					if( not is_clean or c == '"' or c == '\\' ) {
+						break;
+					}
+					++first;
+				}
+				return first;
+			}
+
+			/// @brief Check eight bytes at a time, in a 64bit word.  A byte is
+			/// below 0x20 when subtracting 0x20 borrows into its high bit, and
+			/// equal to k when its xor with k is zero
+			template<bool restrict_high, typename CharT>
+			DAW_ATTRIB_INLINE CharT *
+			mem_find_string_escape( runtime_exec_tag, CharT *first,
+			                        CharT *const last ) {
+				constexpr std::uint64_t ones = 0x0101'0101'0101'0101ULL;
+				constexpr std::uint64_t high_bits = 0x8080'8080'8080'8080ULL;
+				constexpr auto has_zero_byte = []( std::uint64_t v ) {
+					return ( v - ones ) & ~v;
+				};
+				while( last - first >= 8 ) {
+					std::uint64_t word;
+					std::memcpy( &word, first, sizeof( word ) );
+					std::uint64_t found = ( ( word - ones * 0x20U ) & ~word ) |
+					                      has_zero_byte( word ^ ( ones * '"' ) ) |
+					                      has_zero_byte( word ^ ( ones * '\\' ) );
+					if constexpr( restrict_high ) {
+						found |= word | has_zero_byte( word ^ ( ones * 0x7FU ) );
+					}
+					if( ( found & high_bits ) != 0 ) {
+						break;
+					}
+					first += 8;
+				}
+				return mem_find_string_escape<restrict_high>( constexpr_exec_tag{ },
+				                                              first, last );
+			}
+
+#if defined( DAW_JSON_HAS_SSE42_KERNELS )
 			struct key_table_t {
 				alignas( 16 ) bool values[256] = { };
 
@@ -88,8 +164,28 @@ namespace daw::json {
 #endif
 			}
 
-#if defined( DAW_ALLOW_SSE42 )
-			DAW_ATTRIB_INLINE __m128i
+#if defined( DAW_JSON_HAS_AVX512_KERNELS )
+			inline std::ptrdiff_t find_lsb_set( runtime_exec_tag, UInt64 value ) {
+#if DAW_HAS_BUILTIN( __builtin_ctzll )
+				return static_cast<std::ptrdiff_t>(
+				  __builtin_ctzll( static_cast<unsigned long long>( value ) ) );
+#elif defined( DAW_HAS_MSVC_LIKE )
+				unsigned long index;
+				_BitScanForward64( &index, static_cast<unsigned __int64>( value ) );
+				return static_cast<std::ptrdiff_t>( index );
+#else
+				std::ptrdiff_t result = 0;
+				while( ( value & 1_u64 ) == 0_u64 ) {
+					value >>= 1U;
+					++result;
+				}
+				return result;
+#endif
+			}
+#endif
+
+#if defined( DAW_JSON_HAS_SSE42_KERNELS )
+			DAW_ATTRIB_INLINE DAW_JSON_TARGET_SSE42 __m128i
 			set_reverse( char c0, char c1 = 0, char c2 = 0, char c3 = 0, char c4 = 0,
 			             char c5 = 0, char c6 = 0, char c7 = 0, char c8 = 0,
 			             char c9 = 0, char c10 = 0, char c11 = 0, char c12 = 0,
@@ -98,34 +194,36 @@ namespace daw::json {
 				                     c4, c3, c2, c1, c0 );
 			}
 
-			DAW_ATTRIB_INLINE __m128i uload16_char_data( sse42_exec_tag,
-			                                             char const *ptr ) {
+			DAW_ATTRIB_INLINE DAW_JSON_TARGET_SSE42 __m128i
+			uload16_char_data( sse42_exec_tag, char const *ptr ) {
 				return _mm_loadu_si128( reinterpret_cast<__m128i const *>( ptr ) );
 			}
 
-			DAW_ATTRIB_INLINE __m128i load16_char_data( sse42_exec_tag,
-			                                            char const *ptr ) {
+			DAW_ATTRIB_INLINE DAW_JSON_TARGET_SSE42 __m128i
+			load16_char_data( sse42_exec_tag, char const *ptr ) {
 				return _mm_load_si128( reinterpret_cast<__m128i const *>( ptr ) );
 			}
 
 			template<char k>
-			DAW_ATTRIB_INLINE UInt32 mem_find_eq( sse42_exec_tag, __m128i block ) {
+			DAW_ATTRIB_INLINE DAW_JSON_TARGET_SSE42 UInt32
+			mem_find_eq( sse42_exec_tag, __m128i block ) {
 				__m128i const keys = _mm_set1_epi8( k );
 				__m128i const found = _mm_cmpeq_epi8( block, keys );
 				return to_uint32( _mm_movemask_epi8( found ) );
 			}
 
 			template<unsigned char k>
-			DAW_ATTRIB_INLINE UInt32 mem_find_gt( sse42_exec_tag, __m128i block ) {
+			DAW_ATTRIB_INLINE DAW_JSON_TARGET_SSE42 UInt32
+			mem_find_gt( sse42_exec_tag, __m128i block ) {
 				static __m128i const keys = _mm_set1_epi8( k );
 				__m128i const found = _mm_cmpgt_epi8( block, keys );
 				return to_uint32( _mm_movemask_epi8( found ) );
 			}
 
 			template<bool is_unchecked_input, char... keys, typename CharT>
-			DAW_ATTRIB_INLINE CharT *mem_move_to_next_of( sse42_exec_tag tag,
-			                                              CharT *first,
-			                                              CharT *const last ) {
+			DAW_ATTRIB_INLINE DAW_JSON_TARGET_SSE42 CharT *
+			mem_move_to_next_of( sse42_exec_tag tag, CharT *first,
+			                     CharT *const last ) {
 
 				while( last - first >= 16 ) {
 					auto const val0 = uload16_char_data( tag, first );
@@ -150,7 +248,7 @@ namespace daw::json {
 			}
 
 			template<bool is_unchecked_input, char... keys, typename CharT>
-			DAW_ATTRIB_INLINE CharT *
+			DAW_ATTRIB_INLINE DAW_JSON_TARGET_SSE42 CharT *
 			mem_move_to_next_not_of( sse42_exec_tag tag, CharT *first, CharT *last ) {
 				using keys_len = daw::constant<static_cast<int>( sizeof...( keys ) )>;
 				using compare_mode = daw::constant<static_cast<int>(
@@ -229,7 +327,8 @@ namespace daw::json {
 				return ( even_bits::value ^ invert_mask ) & follow_escape;
 			}
 
-			DAW_ATTRIB_INLINE UInt32 prefix_xor( sse42_exec_tag, UInt32 bitmask ) {
+			DAW_ATTRIB_INLINE DAW_JSON_TARGET_SSE42 UInt32
+			prefix_xor( sse42_exec_tag, UInt32 bitmask ) {
 				__m128i const all_ones = _mm_set1_epi8( '\xFF' );
 				__m128i const result = _mm_clmulepi64_si128(
 				  _mm_set_epi32( 0, 0, 0, static_cast<std::int32_t>( bitmask ) ),
@@ -238,9 +337,9 @@ namespace daw::json {
 			}
 
 			template<bool is_unchecked_input, typename CharT>
-			inline CharT *mem_skip_until_end_of_string( simd_exec_tag tag,
-			                                            CharT *first,
-			                                            CharT *const last ) {
+			DAW_JSON_TARGET_SSE42 inline CharT *
+			mem_skip_until_end_of_string( sse42_exec_tag tag, CharT *first,
+			                              CharT *const last ) {
 				UInt32 prev_escapes = 0_u32;
 				while( last - first >= 16 ) {
 					auto const val0 = uload16_char_data( tag, first );
@@ -255,6 +354,10 @@ namespace daw::json {
 					}
 					first += 16;
 				}
+				// A trailing backslash in the last block escapes the next character
+				if( ( prev_escapes != 0 ) & ( first < last ) ) {
+					++first;
+				}
 				if constexpr( is_unchecked_input ) {
 					while( *first != '"' ) {
 						while( not key_table<'"', '\\'>[*first] ) {
@@ -285,8 +388,8 @@ namespace daw::json {
 			}
 
 			template<bool is_unchecked_input, typename CharT>
-			inline CharT *
-			mem_skip_until_end_of_string( simd_exec_tag tag, CharT *first,
+			DAW_JSON_TARGET_SSE42 inline CharT *
+			mem_skip_until_end_of_string( sse42_exec_tag tag, CharT *first,
 			                              CharT *const last,
 			                              std::ptrdiff_t &first_escape ) {
 				CharT *const first_first = first;
@@ -294,19 +397,28 @@ namespace daw::json {
 				while( last - first >= 16 ) {
 					auto const val0 = uload16_char_data( tag, first );
 					UInt32 const backslashes = mem_find_eq<'\\'>( tag, val0 );
-					if( ( backslashes != 0 ) & ( first_escape < 0 ) ) {
-						first_escape = find_lsb_set( tag, backslashes );
-					}
 					UInt32 const escaped =
 					  find_escaped_branchless( tag, prev_escapes, backslashes );
 					UInt32 const quotes = mem_find_eq<'"'>( tag, val0 ) & ( ~escaped );
 					UInt32 const in_string = prefix_xor( tag, quotes );
+					if( ( backslashes != 0 ) & ( first_escape < 0 ) ) {
+						auto const escape_pos = find_lsb_set( tag, backslashes );
+						// Only escapes prior to the closing quote are part of the string
+						if( ( in_string == 0_u32 ) or
+						    escape_pos < find_lsb_set( tag, in_string ) ) {
+							first_escape = ( first - first_first ) + escape_pos;
+						}
+					}
 					if( in_string != 0 ) {
 						first += find_lsb_set( tag, in_string );
 						return first;
 					}
 					first += 16;
 				}
+				// A trailing backslash in the last block escapes the next character
+				if( ( prev_escapes != 0 ) & ( first < last ) ) {
+					++first;
+				}
 				if constexpr( is_unchecked_input ) {
 					while( *first != '"' ) {
 						while( not key_table<'"', '\\'>[*first] ) {
@@ -316,7 +428,7 @@ namespace daw::json {
 							return first;
 						}
 						if( first_escape < 0 ) {
-							first_escape = first_first - first;
+							first_escape = first - first_first;
 						}
 						first += 2;
 					}
@@ -333,7 +445,7 @@ namespace daw::json {
 							return first;
 						}
 						if( first_escape < 0 ) {
-							first_escape = first_first - first;
+							first_escape = first - first_first;
 						}
 						first += 2;
 					}
@@ -342,6 +454,468 @@ namespace daw::json {
 				                                                            : last;
 			}
 
+			/// Whitespace and control characters are the bytes 0x01-0x20.
+			/// Subtracting one moves them to 0x00-0x1F so that an unsigned min
+			/// with 0x1F leaves them unchanged
+			DAW_ATTRIB_INLINE DAW_JSON_TARGET_SSE42 UInt32
+			mem_find_not_whitespace( sse42_exec_tag, __m128i block ) {
+				__m128i const shifted = _mm_sub_epi8( block, _mm_set1_epi8( 1 ) );
+				__m128i const is_ws = _mm_cmpeq_epi8(
+				  _mm_min_epu8( shifted, _mm_set1_epi8( 0x1F ) ), shifted );
+				return to_uint32( ~_mm_movemask_epi8( is_ws ) & 0xFFFF );
+			}
+
+			template<typename CharT>
+			DAW_ATTRIB_INLINE DAW_JSON_TARGET_SSE42 CharT *
+			mem_skip_whitespace( sse42_exec_tag tag, CharT *first,
+			                     CharT *const last ) {
+				while( last - first >= 16 ) {
+					UInt32 const not_ws =
+					  mem_find_not_whitespace( tag, uload16_char_data( tag, first ) );
+					if( not_ws != 0_u32 ) {
+						return first + find_lsb_set( tag, not_ws );
+					}
+					first += 16;
+				}
+				return mem_skip_whitespace( constexpr_exec_tag{ }, first, last );
+			}
+
+			/// Printable ASCII is 0x20-0x7E.  Subtracting 0x20 moves it to
+			/// 0x00-0x5E so that an unsigned min with 0x5E leaves it unchanged.
+			/// Without restrict_high only bytes below 0x20 are unclean, and an
+			/// unsigned min with 0x1F leaves those unchanged
+			template<bool restrict_high>
+			DAW_ATTRIB_INLINE DAW_JSON_TARGET_SSE42 UInt32
+			string_escape_mask( sse42_exec_tag tag, __m128i block ) {
+				UInt32 const quotes =
+				  mem_find_eq<'"'>( tag, block ) | mem_find_eq<'\\'>( tag, block );
+				if constexpr( restrict_high ) {
+					__m128i const shifted = _mm_sub_epi8( block, _mm_set1_epi8( 0x20 ) );
+					__m128i const is_printable = _mm_cmpeq_epi8(
+					  _mm_min_epu8( shifted, _mm_set1_epi8( 0x5E ) ), shifted );
+					return to_uint32( ~_mm_movemask_epi8( is_printable ) & 0xFFFF ) |
+					       quotes;
+				} else {
+					__m128i const is_control = _mm_cmpeq_epi8(
+					  _mm_min_epu8( block, _mm_set1_epi8( 0x1F ) ), block );
+					return to_uint32( _mm_movemask_epi8( is_control ) ) | quotes;
+				}
+			}
+
+			template<bool restrict_high, typename CharT>
+			DAW_ATTRIB_INLINE DAW_JSON_TARGET_SSE42 CharT *
+			mem_find_string_escape( sse42_exec_tag tag, CharT *first,
+			                        CharT *const last ) {
+				while( last - first >= 16 ) {
+					UInt32 const found = string_escape_mask<restrict_high>(
+					  tag, uload16_char_data( tag, first ) );
+					if( found != 0_u32 ) {
+						return first + find_lsb_set( tag, found );
+					}
+					first += 16;
+				}
+				return mem_find_string_escape<restrict_high>( runtime_exec_tag{ },
+				                                              first, last );
+			}
+
+			/// @brief Find the brackets, braces, and commas in the 16 bytes at ptr
+			/// that are not inside a string.
+			/// @param prev_escaped carries a trailing backslash to the next block
+			/// @param prev_in_string is all ones when the previous block ended
+			/// inside a string, zero otherwise
+			DAW_ATTRIB_INLINE DAW_JSON_TARGET_SSE42 UInt32
+			find_structurals( sse42_exec_tag tag, char const *ptr,
+			                  UInt32 &prev_escaped, UInt32 &prev_in_string ) {
+				__m128i const block = uload16_char_data( tag, ptr );
+				UInt32 const backslashes = mem_find_eq<'\\'>( tag, block );
+				UInt32 const escaped =
+				  find_escaped_branchless( tag, prev_escaped, backslashes );
+				UInt32 const quotes = mem_find_eq<'"'>( tag, block ) & ( ~escaped );
+				UInt32 const in_string =
+				  ( prefix_xor( tag, quotes ) ^ prev_in_string ) & 0xFFFF_u32;
+				prev_in_string =
+				  ( ( in_string >> 15U ) & 1_u32 ) != 0_u32 ? 0xFFFF_u32 : 0_u32;
+				UInt32 const structurals =
+				  mem_find_eq<'{'>( tag, block ) | mem_find_eq<'}'>( tag, block ) |
+				  mem_find_eq<'['>( tag, block ) | mem_find_eq<']'>( tag, block ) |
+				  mem_find_eq<','>( tag, block );
+				return structurals & ( ~( in_string | escaped ) );
+			}
+#endif
+#if defined( DAW_JSON_HAS_AVX2_KERNELS )
+			DAW_ATTRIB_INLINE DAW_JSON_TARGET_AVX2 __m256i
+			uload32_char_data( avx2_exec_tag, char const *ptr ) {
+				return _mm256_loadu_si256( reinterpret_cast<__m256i const *>( ptr ) );
+			}
+
+			template<char k>
+			DAW_ATTRIB_INLINE DAW_JSON_TARGET_AVX2 UInt32
+			mem_find_eq( avx2_exec_tag, __m256i block ) {
+				__m256i const keys = _mm256_set1_epi8( k );
+				__m256i const found = _mm256_cmpeq_epi8( block, keys );
+				return to_uint32( _mm256_movemask_epi8( found ) );
+			}
+
+			template<bool is_unchecked_input, char... keys, typename CharT>
+			DAW_ATTRIB_INLINE DAW_JSON_TARGET_AVX2 CharT *
+			mem_move_to_next_of( avx2_exec_tag tag, CharT *first,
+			                     CharT *const last ) {
+				while( last - first >= 32 ) {
+					auto const val0 = uload32_char_data( tag, first );
+					auto const key_positions = ( mem_find_eq<keys>( tag, val0 ) | ... );
+					if( key_positions != 0_u32 ) {
+						return first + find_lsb_set( tag, key_positions );
+					}
+					first += 32;
+				}
+				return mem_move_to_next_of<is_unchecked_input, keys...>(
+				  sse42_exec_tag{ }, first, last );
+			}
+
+			/// Same as the 16 byte version, but the carry of the 32bit sum is kept
+			/// to know if the next block starts escaped
+			DAW_ATTRIB_INLINE UInt32 find_escaped_branchless( avx2_exec_tag,
+			                                                  UInt32 &prev_escaped,
+			                                                  UInt32 backslashes ) {
+				backslashes &= ~prev_escaped;
+				UInt32 const follow_escape = ( backslashes << 1U ) | prev_escaped;
+				using even_bits = daw::constant<0x5555'5555_u32>;
+
+				UInt32 const odd_seq_start =
+				  backslashes & ( ~even_bits::value ) & ( ~follow_escape );
+				std::uint64_t const sum = static_cast<std::uint64_t>( odd_seq_start ) +
+				                          static_cast<std::uint64_t>( backslashes );
+				prev_escaped = static_cast<UInt32>( sum >> 32U );
+				UInt32 const seq_start_on_even_bits =
+				  static_cast<UInt32>( static_cast<std::uint32_t>( sum ) );
+				UInt32 const invert_mask = seq_start_on_even_bits << 1U;
+
+				return ( even_bits::value ^ invert_mask ) & follow_escape;
+			}
+
+			template<bool is_unchecked_input, typename CharT>
+			DAW_JSON_TARGET_AVX2 inline CharT *
+			mem_skip_until_end_of_string( avx2_exec_tag tag, CharT *first,
+			                              CharT *const last ) {
+				UInt32 prev_escapes = 0_u32;
+				while( last - first >= 32 ) {
+					auto const val0 = uload32_char_data( tag, first );
+					UInt32 const backslashes = mem_find_eq<'\\'>( tag, val0 );
+					UInt32 const escaped =
+					  find_escaped_branchless( tag, prev_escapes, backslashes );
+					UInt32 const quotes = mem_find_eq<'"'>( tag, val0 ) & ( ~escaped );
+					UInt32 const in_string = prefix_xor( tag, quotes );
+					if( in_string != 0_u32 ) {
+						return first + find_lsb_set( tag, in_string );
+					}
+					first += 32;
+				}
+				// A trailing backslash in the last block escapes the next character
+				if( ( prev_escapes != 0_u32 ) & ( first < last ) ) {
+					++first;
+				}
+				return mem_skip_until_end_of_string<is_unchecked_input>(
+				  sse42_exec_tag{ }, first, last );
+			}
+
+			template<bool is_unchecked_input, typename CharT>
+			DAW_JSON_TARGET_AVX2 inline CharT *
+			mem_skip_until_end_of_string( avx2_exec_tag tag, CharT *first,
+			                              CharT *const last,
+			                              std::ptrdiff_t &first_escape ) {
+				CharT *const first_first = first;
+				UInt32 prev_escapes = 0_u32;
+				while( last - first >= 32 ) {
+					auto const val0 = uload32_char_data( tag, first );
+					UInt32 const backslashes = mem_find_eq<'\\'>( tag, val0 );
+					UInt32 const escaped =
+					  find_escaped_branchless( tag, prev_escapes, backslashes );
+					UInt32 const quotes = mem_find_eq<'"'>( tag, val0 ) & ( ~escaped );
+					UInt32 const in_string = prefix_xor( tag, quotes );
+					if( ( backslashes != 0_u32 ) & ( first_escape < 0 ) ) {
+						auto const escape_pos = find_lsb_set( tag, backslashes );
+						// Only escapes prior to the closing quote are part of the string
+						if( ( in_string == 0_u32 ) or
+						    escape_pos < find_lsb_set( tag, in_string ) ) {
+							first_escape = ( first - first_first ) + escape_pos;
+						}
+					}
+					if( in_string != 0_u32 ) {
+						return first + find_lsb_set( tag, in_string );
+					}
+					first += 32;
+				}
+				if( ( prev_escapes != 0_u32 ) & ( first < last ) ) {
+					++first;
+				}
+				std::ptrdiff_t tail_escape = -1;
+				CharT *const tail_first = first;
+				first = mem_skip_until_end_of_string<is_unchecked_input>(
+				  sse42_exec_tag{ }, first, last, tail_escape );
+				if( ( first_escape < 0 ) & ( tail_escape >= 0 ) ) {
+					first_escape = ( tail_first - first_first ) + tail_escape;
+				}
+				return first;
+			}
+
+			DAW_ATTRIB_INLINE DAW_JSON_TARGET_AVX2 UInt32
+			mem_find_not_whitespace( avx2_exec_tag, __m256i block ) {
+				__m256i const shifted = _mm256_sub_epi8( block, _mm256_set1_epi8( 1 ) );
+				__m256i const is_ws = _mm256_cmpeq_epi8(
+				  _mm256_min_epu8( shifted, _mm256_set1_epi8( 0x1F ) ), shifted );
+				return ~to_uint32( _mm256_movemask_epi8( is_ws ) );
+			}
+
+			template<typename CharT>
+			DAW_ATTRIB_INLINE DAW_JSON_TARGET_AVX2 CharT *
+			mem_skip_whitespace( avx2_exec_tag tag, CharT *first,
+			                     CharT *const last ) {
+				while( last - first >= 32 ) {
+					UInt32 const not_ws =
+					  mem_find_not_whitespace( tag, uload32_char_data( tag, first ) );
+					if( not_ws != 0_u32 ) {
+						return first + find_lsb_set( tag, not_ws );
+					}
+					first += 32;
+				}
+				return mem_skip_whitespace( sse42_exec_tag{ }, first, last );
+			}
+
+			template<bool restrict_high>
+			DAW_ATTRIB_INLINE DAW_JSON_TARGET_AVX2 UInt32
+			string_escape_mask( avx2_exec_tag tag, __m256i block ) {
+				UInt32 const quotes =
+				  mem_find_eq<'"'>( tag, block ) | mem_find_eq<'\\'>( tag, block );
+				if constexpr( restrict_high ) {
+					__m256i const shifted =
+					  _mm256_sub_epi8( block, _mm256_set1_epi8( 0x20 ) );
+					__m256i const is_printable = _mm256_cmpeq_epi8(
+					  _mm256_min_epu8( shifted, _mm256_set1_epi8( 0x5E ) ), shifted );
+					return ~to_uint32( _mm256_movemask_epi8( is_printable ) ) | quotes;
+				} else {
+					__m256i const is_control = _mm256_cmpeq_epi8(
+					  _mm256_min_epu8( block, _mm256_set1_epi8( 0x1F ) ), block );
+					return to_uint32( _mm256_movemask_epi8( is_control ) ) | quotes;
+				}
+			}
+
+			template<bool restrict_high, typename CharT>
+			DAW_ATTRIB_INLINE DAW_JSON_TARGET_AVX2 CharT *
+			mem_find_string_escape( avx2_exec_tag tag, CharT *first,
+			                        CharT *const last ) {
+				while( last - first >= 32 ) {
+					UInt32 const found = string_escape_mask<restrict_high>(
+					  tag, uload32_char_data( tag, first ) );
+					if( found != 0_u32 ) {
+						return first + find_lsb_set( tag, found );
+					}
+					first += 32;
+				}
+				return mem_find_string_escape<restrict_high>( sse42_exec_tag{ },
+				                                              first, last );
+			}
+
+			DAW_ATTRIB_INLINE DAW_JSON_TARGET_AVX2 UInt32
+			find_structurals( avx2_exec_tag tag, char const *ptr,
+			                  UInt32 &prev_escaped, UInt32 &prev_in_string ) {
+				__m256i const block = uload32_char_data( tag, ptr );
+				UInt32 const backslashes = mem_find_eq<'\\'>( tag, block );
+				UInt32 const escaped =
+				  find_escaped_branchless( tag, prev_escaped, backslashes );
+				UInt32 const quotes = mem_find_eq<'"'>( tag, block ) & ( ~escaped );
+				UInt32 const in_string = prefix_xor( tag, quotes ) ^ prev_in_string;
+				prev_in_string = ( ( in_string >> 31U ) & 1_u32 ) != 0_u32
+				                   ? 0xFFFF'FFFF_u32
+				                   : 0_u32;
+				UInt32 const structurals =
+				  mem_find_eq<'{'>( tag, block ) | mem_find_eq<'}'>( tag, block ) |
+				  mem_find_eq<'['>( tag, block ) | mem_find_eq<']'>( tag, block ) |
+				  mem_find_eq<','>( tag, block );
+				return structurals & ( ~( in_string | escaped ) );
+			}
+#endif
+#if defined( DAW_JSON_HAS_AVX512_KERNELS )
+			DAW_ATTRIB_INLINE DAW_JSON_TARGET_AVX512 __m512i
+			uload64_char_data( avx512_exec_tag, char const *ptr ) {
+				return _mm512_loadu_si512( static_cast<void const *>( ptr ) );
+			}
+
+			template<char k>
+			DAW_ATTRIB_INLINE DAW_JSON_TARGET_AVX512 UInt64
+			mem_find_eq( avx512_exec_tag, __m512i block ) {
+				__m512i const keys = _mm512_set1_epi8( k );
+				return to_uint64( _mm512_cmpeq_epi8_mask( block, keys ) );
+			}
+
+			template<bool is_unchecked_input, char... keys, typename CharT>
+			DAW_ATTRIB_INLINE DAW_JSON_TARGET_AVX512 CharT *
+			mem_move_to_next_of( avx512_exec_tag tag, CharT *first,
+			                     CharT *const last ) {
+				while( last - first >= 64 ) {
+					auto const val0 = uload64_char_data( tag, first );
+					auto const key_positions = ( mem_find_eq<keys>( tag, val0 ) | ... );
+					if( key_positions != 0_u64 ) {
+						return first + find_lsb_set( tag, key_positions );
+					}
+					first += 64;
+				}
+				return mem_move_to_next_of<is_unchecked_input, keys...>(
+				  avx2_exec_tag{ }, first, last );
+			}
+
+			/// 64bit blocks cannot widen the sum, so the carry out is detected by
+			/// wrap around
+			DAW_ATTRIB_INLINE UInt64 find_escaped_branchless( avx512_exec_tag,
+			                                                  UInt64 &prev_escaped,
+			                                                  UInt64 backslashes ) {
+				backslashes &= ~prev_escaped;
+				UInt64 const follow_escape = ( backslashes << 1U ) | prev_escaped;
+				using even_bits = daw::constant<0x5555'5555'5555'5555_u64>;
+
+				UInt64 const odd_seq_start =
+				  backslashes & ( ~even_bits::value ) & ( ~follow_escape );
+				std::uint64_t const sum = static_cast<std::uint64_t>( odd_seq_start ) +
+				                          static_cast<std::uint64_t>( backslashes );
+				prev_escaped = static_cast<UInt64>(
+				  sum < static_cast<std::uint64_t>( backslashes ) ? 1U : 0U );
+				UInt64 const invert_mask = static_cast<UInt64>( sum ) << 1U;
+
+				return ( even_bits::value ^ invert_mask ) & follow_escape;
+			}
+
+			DAW_ATTRIB_INLINE DAW_JSON_TARGET_AVX512 UInt64
+			prefix_xor( avx512_exec_tag, UInt64 bitmask ) {
+				__m128i const all_ones = _mm_set1_epi8( '\xFF' );
+				__m128i const result = _mm_clmulepi64_si128(
+				  _mm_set_epi64x( 0, static_cast<long long>( bitmask ) ), all_ones, 0 );
+				return to_uint64( _mm_cvtsi128_si64( result ) );
+			}
+
+			template<bool is_unchecked_input, typename CharT>
+			DAW_JSON_TARGET_AVX512 inline CharT *
+			mem_skip_until_end_of_string( avx512_exec_tag tag, CharT *first,
+			                              CharT *const last ) {
+				UInt64 prev_escapes = 0_u64;
+				while( last - first >= 64 ) {
+					auto const val0 = uload64_char_data( tag, first );
+					UInt64 const backslashes = mem_find_eq<'\\'>( tag, val0 );
+					UInt64 const escaped =
+					  find_escaped_branchless( tag, prev_escapes, backslashes );
+					UInt64 const quotes = mem_find_eq<'"'>( tag, val0 ) & ( ~escaped );
+					UInt64 const in_string = prefix_xor( tag, quotes );
+					if( in_string != 0_u64 ) {
+						return first + find_lsb_set( tag, in_string );
+					}
+					first += 64;
+				}
+				if( ( prev_escapes != 0_u64 ) & ( first < last ) ) {
+					++first;
+				}
+				return mem_skip_until_end_of_string<is_unchecked_input>(
+				  avx2_exec_tag{ }, first, last );
+			}
+
+			template<bool is_unchecked_input, typename CharT>
+			DAW_JSON_TARGET_AVX512 inline CharT *
+			mem_skip_until_end_of_string( avx512_exec_tag tag, CharT *first,
+			                              CharT *const last,
+			                              std::ptrdiff_t &first_escape ) {
+				CharT *const first_first = first;
+				UInt64 prev_escapes = 0_u64;
+				while( last - first >= 64 ) {
+					auto const val0 = uload64_char_data( tag, first );
+					UInt64 const backslashes = mem_find_eq<'\\'>( tag, val0 );
+					UInt64 const escaped =
+					  find_escaped_branchless( tag, prev_escapes, backslashes );
+					UInt64 const quotes = mem_find_eq<'"'>( tag, val0 ) & ( ~escaped );
+					UInt64 const in_string = prefix_xor( tag, quotes );
+					if( ( backslashes != 0_u64 ) & ( first_escape < 0 ) ) {
+						auto const escape_pos = find_lsb_set( tag, backslashes );
+						// Only escapes prior to the closing quote are part of the string
+						if( ( in_string == 0_u64 ) or
+						    escape_pos < find_lsb_set( tag, in_string ) ) {
+							first_escape = ( first - first_first ) + escape_pos;
+						}
+					}
+					if( in_string != 0_u64 ) {
+						return first + find_lsb_set( tag, in_string );
+					}
+					first += 64;
+				}
+				if( ( prev_escapes != 0_u64 ) & ( first < last ) ) {
+					++first;
+				}
+				std::ptrdiff_t tail_escape = -1;
+				CharT *const tail_first = first;
+				first = mem_skip_until_end_of_string<is_unchecked_input>(
+				  avx2_exec_tag{ }, first, last, tail_escape );
+				if( ( first_escape < 0 ) & ( tail_escape >= 0 ) ) {
+					first_escape = ( tail_first - first_first ) + tail_escape;
+				}
+				return first;
+			}
+
+			template<typename CharT>
+			DAW_ATTRIB_INLINE DAW_JSON_TARGET_AVX512 CharT *
+			mem_skip_whitespace( avx512_exec_tag tag, CharT *first,
+			                     CharT *const last ) {
+				while( last - first >= 64 ) {
+					__m512i const shifted = _mm512_sub_epi8(
+					  uload64_char_data( tag, first ), _mm512_set1_epi8( 1 ) );
+					UInt64 const not_ws = ~to_uint64(
+					  _mm512_cmple_epu8_mask( shifted, _mm512_set1_epi8( 0x1F ) ) );
+					if( not_ws != 0_u64 ) {
+						return first + find_lsb_set( tag, not_ws );
+					}
+					first += 64;
+				}
+				return mem_skip_whitespace( avx2_exec_tag{ }, first, last );
+			}
+
+			template<bool restrict_high, typename CharT>
+			DAW_ATTRIB_INLINE DAW_JSON_TARGET_AVX512 CharT *
+			mem_find_string_escape( avx512_exec_tag tag, CharT *first,
+			                        CharT *const last ) {
+				while( last - first >= 64 ) {
+					__m512i const block = uload64_char_data( tag, first );
+					UInt64 found =
+					  mem_find_eq<'"'>( tag, block ) | mem_find_eq<'\\'>( tag, block );
+					if constexpr( restrict_high ) {
+						__m512i const shifted =
+						  _mm512_sub_epi8( block, _mm512_set1_epi8( 0x20 ) );
+						found |= to_uint64(
+						  _mm512_cmpgt_epu8_mask( shifted, _mm512_set1_epi8( 0x5E ) ) );
+					} else {
+						found |= to_uint64(
+						  _mm512_cmplt_epu8_mask( block, _mm512_set1_epi8( 0x20 ) ) );
+					}
+					if( found != 0_u64 ) {
+						return first + find_lsb_set( tag, found );
+					}
+					first += 64;
+				}
+				return mem_find_string_escape<restrict_high>( avx2_exec_tag{ },
+				                                              first, last );
+			}
+
+			DAW_ATTRIB_INLINE DAW_JSON_TARGET_AVX512 UInt64
+			find_structurals( avx512_exec_tag tag, char const *ptr,
+			                  UInt64 &prev_escaped, UInt64 &prev_in_string ) {
+				__m512i const block = uload64_char_data( tag, ptr );
+				UInt64 const backslashes = mem_find_eq<'\\'>( tag, block );
+				UInt64 const escaped =
+				  find_escaped_branchless( tag, prev_escaped, backslashes );
+				UInt64 const quotes = mem_find_eq<'"'>( tag, block ) & ( ~escaped );
+				UInt64 const in_string = prefix_xor( tag, quotes ) ^ prev_in_string;
+				prev_in_string = ( ( in_string >> 63U ) & 1_u64 ) != 0_u64
+				                   ? 0xFFFF'FFFF'FFFF'FFFF_u64
+				                   : 0_u64;
+				UInt64 const structurals =
+				  mem_find_eq<'{'>( tag, block ) | mem_find_eq<'}'>( tag, block ) |
+				  mem_find_eq<'['>( tag, block ) | mem_find_eq<']'>( tag, block ) |
+				  mem_find_eq<','>( tag, block );
+				return structurals & ( ~( in_string | escaped ) );
+			}
 #endif
 			template<bool is_unchecked_input, char... keys, typename CharT>
 			DAW_ATTRIB_INLINE CharT *
@@ -465,7 +1039,7 @@ namespace daw::json {
 						return first;
 					case '\\':
 						if( first_escape < 0 ) {
-							first_escape = first_first - first;
+							first_escape = first - first_first;
 						}
 						if constexpr( is_unchecked_input ) {
 							++first;
@@ -480,6 +1054,244 @@ namespace daw::json {
 				}
 				return first;
 			}
+
+#if defined( DAW_JSON_CPU_DISPATCH )
+			namespace cpu_dispatch {
+				/// @brief A function pointer that starts out at resolve.  The first
+				/// call selects the kernel for the current CPU and stores it, after
+				/// that each call is a relaxed load and an indirect call
+				/// @tparam Kernels A type with static member functions generic, sse42,
+				/// avx2, and avx512 of type Result( Args... )
+				template<typename Kernels, typename Result, typename... Args>
+				struct kernel_table {
+					using fn_t = Result ( * )( Args... );
+
+					static Result resolve( Args... args ) {
+						fn_t const fn = select_kernel<fn_t>( Kernels::generic,
+						                                     Kernels::sse42, Kernels::avx2,
+						                                     Kernels::avx512 );
+						selected.store( fn, std::memory_order_relaxed );
+						return fn( args... );
+					}
+
+					static inline std::atomic<fn_t> selected{ &resolve };
+
+					DAW_ATTRIB_INLINE static Result call( Args... args ) {
+						return selected.load( std::memory_order_relaxed )( args... );
+					}
+				};
+
+				template<bool is_unchecked_input, char... keys>
+				struct move_to_next_of_kernels
+				  : kernel_table<move_to_next_of_kernels<is_unchecked_input, keys...>,
+				                 char const *, char const *, char const *> {
+
+					static char const *generic( char const *first, char const *last ) {
+						return mem_move_to_next_of<is_unchecked_input, keys...>(
+						  runtime_exec_tag{ }, first, last );
+					}
+
+					DAW_JSON_TARGET_SSE42 static char const *
+					sse42( char const *first, char const *last ) {
+						return mem_move_to_next_of<is_unchecked_input, keys...>(
+						  sse42_exec_tag{ }, first, last );
+					}
+
+					DAW_JSON_TARGET_AVX2 static char const *
+					avx2( char const *first, char const *last ) {
+						return mem_move_to_next_of<is_unchecked_input, keys...>(
+						  avx2_exec_tag{ }, first, last );
+					}
+
+					DAW_JSON_TARGET_AVX512 static char const *
+					avx512( char const *first, char const *last ) {
+						return mem_move_to_next_of<is_unchecked_input, keys...>(
+						  avx512_exec_tag{ }, first, last );
+					}
+				};
+
+				template<bool is_unchecked_input>
+				struct skip_string_kernels
+				  : kernel_table<skip_string_kernels<is_unchecked_input>, char const *,
+				                 char const *, char const *> {
+
+					static char const *generic( char const *first, char const *last ) {
+						return mem_skip_until_end_of_string<is_unchecked_input>(
+						  runtime_exec_tag{ }, first, last );
+					}
+
+					DAW_JSON_TARGET_SSE42 static char const *
+					sse42( char const *first, char const *last ) {
+						return mem_skip_until_end_of_string<is_unchecked_input>(
+						  sse42_exec_tag{ }, first, last );
+					}
+
+					DAW_JSON_TARGET_AVX2 static char const *
+					avx2( char const *first, char const *last ) {
+						return mem_skip_until_end_of_string<is_unchecked_input>(
+						  avx2_exec_tag{ }, first, last );
+					}
+
+					DAW_JSON_TARGET_AVX512 static char const *
+					avx512( char const *first, char const *last ) {
+						return mem_skip_until_end_of_string<is_unchecked_input>(
+						  avx512_exec_tag{ }, first, last );
+					}
+				};
+
+				template<bool is_unchecked_input>
+				struct skip_string_escape_kernels
+				  : kernel_table<skip_string_escape_kernels<is_unchecked_input>,
+				                 char const *, char const *, char const *,
+				                 std::ptrdiff_t &> {
+
+					static char const *generic( char const *first, char const *last,
+					                            std::ptrdiff_t &first_escape ) {
+						return mem_skip_until_end_of_string<is_unchecked_input>(
+						  runtime_exec_tag{ }, first, last, first_escape );
+					}
+
+					DAW_JSON_TARGET_SSE42 static char const *
+					sse42( char const *first, char const *last,
+					       std::ptrdiff_t &first_escape ) {
+						return mem_skip_until_end_of_string<is_unchecked_input>(
+						  sse42_exec_tag{ }, first, last, first_escape );
+					}
+
+					DAW_JSON_TARGET_AVX2 static char const *
+					avx2( char const *first, char const *last,
+					      std::ptrdiff_t &first_escape ) {
+						return mem_skip_until_end_of_string<is_unchecked_input>(
+						  avx2_exec_tag{ }, first, last, first_escape );
+					}
+
+					DAW_JSON_TARGET_AVX512 static char const *
+					avx512( char const *first, char const *last,
+					        std::ptrdiff_t &first_escape ) {
+						return mem_skip_until_end_of_string<is_unchecked_input>(
+						  avx512_exec_tag{ }, first, last, first_escape );
+					}
+				};
+
+				struct skip_whitespace_kernels
+				  : kernel_table<skip_whitespace_kernels, char const *, char const *,
+				                 char const *> {
+
+					static char const *generic( char const *first, char const *last ) {
+						return mem_skip_whitespace( constexpr_exec_tag{ }, first, last );
+					}
+
+					DAW_JSON_TARGET_SSE42 static char const *
+					sse42( char const *first, char const *last ) {
+						return mem_skip_whitespace( sse42_exec_tag{ }, first, last );
+					}
+
+					DAW_JSON_TARGET_AVX2 static char const *
+					avx2( char const *first, char const *last ) {
+						return mem_skip_whitespace( avx2_exec_tag{ }, first, last );
+					}
+
+					DAW_JSON_TARGET_AVX512 static char const *
+					avx512( char const *first, char const *last ) {
+						return mem_skip_whitespace( avx512_exec_tag{ }, first, last );
+					}
+				};
+
+				template<bool restrict_high>
+				struct string_escape_kernels
+				  : kernel_table<string_escape_kernels<restrict_high>, char const *,
+				                 char const *, char const *> {
+
+					static char const *generic( char const *first, char const *last ) {
+						return mem_find_string_escape<restrict_high>( runtime_exec_tag{ },
+						                                              first, last );
+					}
+
+					DAW_JSON_TARGET_SSE42 static char const *
+					sse42( char const *first, char const *last ) {
+						return mem_find_string_escape<restrict_high>( sse42_exec_tag{ },
+						                                              first, last );
+					}
+
+					DAW_JSON_TARGET_AVX2 static char const *
+					avx2( char const *first, char const *last ) {
+						return mem_find_string_escape<restrict_high>( avx2_exec_tag{ },
+						                                              first, last );
+					}
+
+					DAW_JSON_TARGET_AVX512 static char const *
+					avx512( char const *first, char const *last ) {
+						return mem_find_string_escape<restrict_high>( avx512_exec_tag{ },
+						                                              first, last );
+					}
+				};
+			} // namespace cpu_dispatch
+
+			template<bool is_unchecked_input, char... keys, typename CharT>
+			DAW_ATTRIB_INLINE CharT *mem_move_to_next_of( cpu_dispatch_exec_tag,
+			                                              CharT *first,
+			                                              CharT *const last ) {
+				char const *const result =
+				  cpu_dispatch::move_to_next_of_kernels<is_unchecked_input,
+				                                        keys...>::call( first, last );
+				return first + ( result - first );
+			}
+
+			template<bool is_unchecked_input, typename CharT>
+			DAW_ATTRIB_INLINE CharT *
+			mem_skip_until_end_of_string( cpu_dispatch_exec_tag, CharT *first,
+			                              CharT *const last ) {
+				char const *const result =
+				  cpu_dispatch::skip_string_kernels<is_unchecked_input>::call( first,
+				                                                               last );
+				return first + ( result - first );
+			}
+
+			template<bool is_unchecked_input, typename CharT>
+			DAW_ATTRIB_INLINE CharT *
+			mem_skip_until_end_of_string( cpu_dispatch_exec_tag, CharT *first,
+			                              CharT *const last,
+			                              std::ptrdiff_t &first_escape ) {
+				char const *const result =
+				  cpu_dispatch::skip_string_escape_kernels<is_unchecked_input>::call(
+				    first, last, first_escape );
+				return first + ( result - first );
+			}
+
+			template<typename CharT>
+			DAW_ATTRIB_INLINE CharT *mem_skip_whitespace( cpu_dispatch_exec_tag,
+			                                              CharT *first,
+			                                              CharT *const last ) {
+				char const *const result =
+				  cpu_dispatch::skip_whitespace_kernels::call( first, last );
+				return first + ( result - first );
+			}
+
+			template<bool restrict_high, typename CharT>
+			DAW_ATTRIB_INLINE CharT *mem_find_string_escape( cpu_dispatch_exec_tag,
+			                                                 CharT *first,
+			                                                 CharT *const last ) {
+				char const *const result =
+				  cpu_dispatch::string_escape_kernels<restrict_high>::call( first,
+				                                                            last );
+				return first + ( result - first );
+			}
+#endif
+
+			/// @brief True when ExecTag has kernels that are faster than a byte at a
+			/// time loop for scanning structural characters and whitespace.  The
+			/// sse4.2 mode keeps its byte at a time loops, so only the avx2, avx512,
+			/// and cpu_dispatch modes qualify
+			template<typename ExecTag>
+			inline constexpr bool has_wide_kernels_v =
+#if defined( DAW_JSON_CPU_DISPATCH )
+			  std::is_same_v<ExecTag, cpu_dispatch_exec_tag> or
+#endif
+#if defined( DAW_JSON_HAS_AVX2_KERNELS )
+			  std::is_base_of_v<avx2_exec_tag, ExecTag>;
+#else
+			  false;
+#endif
 		} // namespace json_details
 	} // namespace DAW_JSON_VER
 } // namespace daw::json
@@ -11,10 +11,12 @@
 #include "version.h"
 
 #include "daw_json_assert.h"
+#include "daw_json_exec_modes.h"
 #include "daw_json_parse_iso8601_utils.h"
 #include "daw_json_serialize_options_impl.h"
 #include "daw_json_serialize_policy.h"
 #include "daw_json_value.h"
+#include "daw_not_const_ex_functions.h"
 #include <daw/json/daw_json_data_contract.h>
 
 #include <daw/daw_algorithm.h>
@@ -31,6 +33,7 @@
 #include <daw/utf8/unchecked.h>
 
 #include <array>
+#include <cstdint>
 #include <daw/stdinc/move_fwd_exch.h>
 #include <daw/stdinc/tuple_traits.h>
 #include <optional>
@@ -47,6 +50,10 @@ namespace daw::json {
 			static constexpr WriteableType
 			to_chars( options::FPOutputFormat fp_output_format, Real const &value,
 			          WriteableType out_it );
+
+			template<unsigned Decimals, typename WriteableType, typename Real>
+			static constexpr WriteableType to_chars_fixed( Real const &value,
+			                                               WriteableType out_it );
 		} // namespace json_details
 
 		namespace json_details::to_strings {
@@ -266,6 +273,113 @@ namespace daw::json {
 				}
 				daw_json_error( ErrorReason::InvalidUTFCodepoint );
 			}
+
+			/// @brief Write a codepoint of a string, escaping it when JSON requires
+			/// it or when restrict_high only allows 7bit output
+			template<bool restrict_high, typename WritableType>
+			static constexpr void output_escaped_codepoint( std::uint32_t cp,
+			                                                WritableType &it ) {
+				switch( cp ) {
+				case '"':
+					it.write( "\\\"" );
+					return;
+				case '\\':
+					it.write( "\\\\" );
+					return;
+				case '\b':
+					it.write( "\\b" );
+					return;
+				case '\f':
+					it.write( "\\f" );
+					return;
+				case '\n':
+					it.write( "\\n" );
+					return;
+				case '\r':
+					it.write( "\\r" );
+					return;
+				case '\t':
+					it.write( "\\t" );
+					return;
+				default:
+					if( cp < 0x20U ) {
+						it = output_hex( static_cast<std::uint16_t>( cp ), it );
+						return;
+					}
+					if constexpr( restrict_high ) {
+						if( cp >= 0x7FU and cp <= 0xFFFFU ) {
+							it = output_hex( static_cast<std::uint16_t>( cp ), it );
+							return;
+						}
+						if( cp > 0xFFFFU ) {
+							it = output_hex(
+							  static_cast<std::uint16_t>( 0xD7C0U + ( cp >> 10U ) ), it );
+							it = output_hex(
+							  static_cast<std::uint16_t>( 0xDC00U + ( cp & 0x3FFU ) ), it );
+							return;
+						}
+					}
+					utf32_to_utf8( cp, it );
+					return;
+				}
+			}
+
+			/// @brief The widest kernel available for finding the bytes of a
+			/// string that need escaping
+#if defined( DAW_JSON_CPU_DISPATCH )
+			using string_escape_exec_tag = cpu_dispatch_exec_tag;
+#else
+			using string_escape_exec_tag = simd512_exec_tag;
+#endif
+
+			template<bool restrict_high>
+			[[nodiscard]] DAW_ATTRIB_INLINE constexpr char const *
+			find_string_escape( char const *first, char const *const last ) {
+#if defined( DAW_IS_CONSTANT_EVALUATED )
+				if( not DAW_IS_CONSTANT_EVALUATED( ) ) {
+					return mem_find_string_escape<restrict_high>(
+					  string_escape_exec_tag{ }, first, last );
+				}
+#endif
+				return mem_find_string_escape<restrict_high>( constexpr_exec_tag{ },
+				                                              first, last );
+			}
+
+			/// @brief Escape the string [first, last).  Runs of bytes that need no
+			/// escaping are found with SIMD where available and written with one
+			/// call, only the codepoints between them are decoded.  Bytes of 0x80
+			/// and up are part of a run unless restrict_high asks for them to be
+			/// escaped
+			template<bool restrict_high, typename WritableType>
+			[[nodiscard]] static constexpr WritableType
+			copy_escaped_string( WritableType it, char const *first,
+			                     char const *const last ) {
+				while( first != last ) {
+					char const *const run_last =
+					  find_string_escape<restrict_high>( first, last );
+					if( run_last != first ) {
+						it.write( std::string_view(
+						  first, static_cast<std::size_t>( run_last - first ) ) );
+						first = run_last;
+						if( first == last ) {
+							break;
+						}
+					}
+					auto const lead = static_cast<unsigned char>( *first );
+					std::ptrdiff_t const cp_size = lead < 0xC0U   ? 1
+					                               : lead < 0xE0U ? 2
+					                               : lead < 0xF0U ? 3
+					                               : lead < 0xF8U ? 4
+					                                              : 1;
+					daw_json_ensure( last - first >= cp_size,
+					                 ErrorReason::InvalidUTFCodepoint );
+					auto chr_it = utf8::unchecked::iterator<char const *>( first );
+					auto const cp = *chr_it++;
+					first = chr_it.base( );
+					output_escaped_codepoint<restrict_high>( cp, it );
+				}
+				return it;
+			}
 		} // namespace json_details
 
 		namespace utils {
@@ -284,68 +398,32 @@ namespace daw::json {
 				  ( WritableType::restricted_string_output ==
 				    options::RestrictedStringOutput::OnlyAllow7bitsStrings );
 				if constexpr( do_escape ) {
-					using iter = DAW_TYPEOF( std::begin( container ) );
-					using it_t = utf8::unchecked::iterator<iter>;
-					auto first = it_t( std::begin( container ) );
-					auto const last = it_t( std::end( container ) );
-					while( first != last ) {
-						auto const last_it = first;
-						auto const cp = *first++;
-						if( last_it == first ) {
-							// Not a valid unicode cp
-							if constexpr( WritableType::restricted_string_output ==
-							              options::RestrictedStringOutput::
-							                ErrorInvalidUTF8 ) {
-								daw_json_error( ErrorReason::InvalidStringHighASCII );
-							} else {
-								first = it_t( std::next( first.base( ) ) );
-							}
-						}
-						switch( cp ) {
-						case '"':
-							it.write( "\\\"" );
-							break;
-						case '\\':
-							it.write( "\\\\" );
-							break;
-						case '\b':
-							it.write( "\\b" );
-							break;
-						case '\f':
-							it.write( "\\f" );
-							break;
-						case '\n':
-							it.write( "\\n" );
-							break;
-						case '\r':
-							it.write( "\\r" );
-							break;
-						case '\t':
-							it.write( "\\t" );
-							break;
-						default:
-							if( cp < 0x20U ) {
-								it = json_details::output_hex( static_cast<std::uint16_t>( cp ),
-								                               it );
-								break;
-							}
-							if constexpr( restrict_high ) {
-								if( cp >= 0x7FU and cp <= 0xFFFFU ) {
-									it = json_details::output_hex(
-									  static_cast<std::uint16_t>( cp ), it );
-									break;
-								}
-								if( cp > 0xFFFFU ) {
-									it = json_details::output_hex(
-									  static_cast<std::uint16_t>( 0xD7C0U + ( cp >> 10U ) ), it );
-									it = json_details::output_hex(
-									  static_cast<std::uint16_t>( 0xDC00U + ( cp & 0x3FFU ) ),
-									  it );
-									break;
+					if constexpr( json_details::is_string_view_like_v<Container> and
+					              std::is_same_v<DAW_TYPEOF( *std::data( container ) ),
+					                             char const &> ) {
+						char const *const first = std::data( container );
+						return json_details::copy_escaped_string<restrict_high>(
+						  it, first, first + std::size( container ) );
+					} else {
+						using iter = DAW_TYPEOF( std::begin( container ) );
+						using it_t = utf8::unchecked::iterator<iter>;
+						auto first = it_t( std::begin( container ) );
+						auto const last = it_t( std::end( container ) );
+						while( first != last ) {
+							auto const last_it = first;
+							auto const cp = *first++;
+							if( last_it == first ) {
+								// Not a valid unicode cp
+								if constexpr( WritableType::restricted_string_output ==
+								              options::RestrictedStringOutput::
+								                ErrorInvalidUTF8 ) {
+									daw_json_error( ErrorReason::InvalidStringHighASCII );
+								} else {
+									first = it_t( std::next( first.base( ) ) );
 								}
 							}
-							json_details::utf32_to_utf8( cp, it );
-							break;
+							json_details::output_escaped_codepoint<restrict_high>( cp,
+							                                                      it );
 						}
 					}
 				} else {
@@ -376,56 +454,8 @@ namespace daw::json {
 				    options::RestrictedStringOutput::OnlyAllow7bitsStrings );
 
 				if constexpr( do_escape ) {
-					auto chr_it = utf8::unchecked::iterator<char const *>( ptr );
-					while( *chr_it.base( ) != '\0' ) {
-						auto const cp = *chr_it++;
-						switch( cp ) {
-						case '"':
-							it.write( "\\\"" );
-							break;
-						case '\\':
-							it.write( "\\\\" );
-							break;
-						case '\b':
-							it.write( "\\b" );
-							break;
-						case '\f':
-							it.write( "\\f" );
-							break;
-						case '\n':
-							it.write( "\\n" );
-							break;
-						case '\r':
-							it.write( "\\r" );
-							break;
-						case '\t':
-							it.write( "\\t" );
-							break;
-						default:
-							if( cp < 0x20U ) {
-								it = json_details::output_hex( static_cast<std::uint16_t>( cp ),
-								                               it );
-								break;
-							}
-							if constexpr( restrict_high ) {
-								if( cp >= 0x7FU and cp <= 0xFFFFU ) {
-									it = json_details::output_hex(
-									  static_cast<std::uint16_t>( cp ), it );
-									break;
-								}
-								if( cp > 0xFFFFU ) {
-									it = json_details::output_hex(
-									  static_cast<std::uint16_t>( 0xD7C0U + ( cp >> 10U ) ), it );
-									it = output_hex(
-									  static_cast<std::uint16_t>( 0xDC00U + ( cp & 0x3FFU ) ),
-									  it );
-									break;
-								}
-							}
-							json_details::utf32_to_utf8( cp, it );
-							break;
-						}
-					}
+					return json_details::copy_escaped_string<restrict_high>(
+					  it, ptr, ptr + std::char_traits<char>::length( ptr ) );
 				} else {
 					while( *ptr != '\0' ) {
 						if constexpr( restrict_high ) {
@@ -600,7 +630,14 @@ namespace daw::json {
 				}
 				if constexpr( daw::is_floating_point_v<parse_to_t> ) {
 					static_assert( sizeof( parse_to_t ) <= sizeof( double ) );
-					it = to_chars( JsonMember::fp_output_format, value, it );
+					if constexpr( JsonMember::fp_fixed_decimals ==
+					              options::FPFixedDecimals::Shortest ) {
+						it = to_chars( JsonMember::fp_output_format, value, it );
+					} else {
+						it = to_chars_fixed<
+						  static_cast<unsigned>( JsonMember::fp_fixed_decimals ) - 1U>(
+						  value, it );
+					}
 				} else {
 					using std::to_string;
 					using to_strings::to_string;
@@ -621,34 +658,59 @@ namespace daw::json {
 			  typename daw::conditional_t<std::is_enum_v<T>, base_int_type_impl<T>,
 			                              daw::traits::identity<T>>::type;
 
+			/// @brief The two character decimal form of 0 through 99
 			DAW_ATTRIB_INLINE DAW_CONSTEVAL std::array<char[2], 100>
-			make_digits100( ) {
+			make_digit_pairs( ) {
 				auto result = std::array<char[2], 100>{ };
 				for( std::size_t n = 0; n < 100; ++n ) {
 					result[n][0] =
-					  static_cast<char>( ( n % 10 ) + static_cast<unsigned char>( '0' ) );
-					result[n][1] =
 					  static_cast<char>( ( n / 10 ) + static_cast<unsigned char>( '0' ) );
+					result[n][1] =
+					  static_cast<char>( ( n % 10 ) + static_cast<unsigned char>( '0' ) );
 				}
 				return result;
 			}
-			inline constexpr auto digits100 = make_digits100( );
-
-			template<typename T>
-			static constexpr void reverse( T *first, T *last ) {
-				// Assume preconditions. This helps on CE in codegen but may
-				// not matter here with inlining
-				DAW_ASSUME( first and last );
-				DAW_ASSUME( first <= last );
-				auto rpos = last - first;
-				auto lpos = 0;
-				while( lpos < rpos ) {
-					--rpos;
-					auto tmp = std::move( first[lpos] );
-					first[lpos] = std::move( first[rpos] );
-					first[rpos] = std::move( tmp );
-					++lpos;
+			inline constexpr auto digit_pairs = make_digit_pairs( );
+
+			/// @brief Write the decimal digits of v so that they end at last.  The
+			/// digits are written four at a time from two digit pair lookups, in
+			/// their final order
+			/// @pre v >= 0 and there is room for all the digits before last
+			/// @return A pointer to the first digit
+			template<typename Integer>
+			DAW_ATTRIB_INLINE static constexpr char *
+			write_digits_backward( char *last, Integer v ) {
+				if constexpr( daw::numeric_limits<Integer>::digits10 >= 4 ) {
+					while( v >= 10000 ) {
+						auto const quad = static_cast<std::size_t>( v % 10000 );
+						v /= 10000;
+						last -= 4;
+						auto const hi = quad / 100U;
+						auto const lo = quad % 100U;
+						last[0] = digit_pairs[hi][0];
+						last[1] = digit_pairs[hi][1];
+						last[2] = digit_pairs[lo][0];
+						last[3] = digit_pairs[lo][1];
+					}
+				}
+				if constexpr( daw::numeric_limits<Integer>::digits10 >= 2 ) {
+					if( v >= 100 ) {
+						auto const pair = static_cast<std::size_t>( v % 100 );
+						v /= 100;
+						last -= 2;
+						last[0] = digit_pairs[pair][0];
+						last[1] = digit_pairs[pair][1];
+					}
+				}
+				if( v >= 10 ) {
+					auto const pair = static_cast<std::size_t>( v );
+					last -= 2;
+					last[0] = digit_pairs[pair][0];
+					last[1] = digit_pairs[pair][1];
+				} else {
+					*--last = static_cast<char>( '0' + static_cast<char>( v ) );
 				}
+				return last;
 			}
 
 			template<typename JsonMember, typename WriteableType, typename parse_to_t>
@@ -668,52 +730,31 @@ namespace daw::json {
 					auto v = static_cast<under_type>( value );
 
 					char buff[daw::numeric_limits<under_type>::digits10 + 10]{ };
-					char *num_start = buff;
-					char *ptr = buff;
+					char *const last = buff + std::size( buff );
+					char *first = last;
 					if constexpr( JsonMember::literal_as_string ==
 					              options::LiteralAsStringOpt::Always ) {
-						*ptr++ = '"';
-						++num_start;
+						*--first = '"';
 					}
 					if( v < 0 ) {
-						*ptr++ = '-';
-						++num_start;
-						// Do 1 round here just in case we are
-						// daw::numeric_limits<intmax_t>::min( ) and cannot negate
-						// This is a subtraction because when v < 0, v % 100 is negative
-						auto const tmp = -static_cast<std::size_t>( v % 10 );
+						// Write the last digit here just in case we are
+						// daw::numeric_limits<intmax_t>::min( ) and cannot negate.
+						// When v < 0, v % 10 is negative
+						*--first =
+						  static_cast<char>( '0' - static_cast<int>( v % 10 ) );
 						v /= -10;
-						*ptr++ = digits100[tmp][0];
-						if( v == 0 ) {
-							if constexpr( JsonMember::literal_as_string ==
-							              options::LiteralAsStringOpt::Always ) {
-								*ptr++ = '"';
-							}
-							it.copy_buffer( buff, ptr );
-							return it;
+						if( v > 0 ) {
+							first = write_digits_backward( first, v );
 						}
+						*--first = '-';
+					} else {
+						first = write_digits_backward( first, v );
 					}
-
-					if( v == 0 ) {
-						*ptr++ = '0';
-					}
-					while( v >= 10 ) {
-						auto const tmp = static_cast<std::size_t>( v % 100 );
-						v /= 100;
-						ptr[0] = digits100[tmp][0];
-						ptr[1] = digits100[tmp][1];
-						ptr += 2;
-					}
-					if( v > 0 ) {
-						*ptr++ = static_cast<char>( '0' + static_cast<char>( v ) );
-					}
-
-					reverse( num_start, ptr );
 					if constexpr( JsonMember::literal_as_string ==
 					              options::LiteralAsStringOpt::Always ) {
-						*ptr++ = '"';
+						*--first = '"';
 					}
-					it.copy_buffer( buff, ptr );
+					it.copy_buffer( first, last );
 					return it;
 				} else {
 					if constexpr( JsonMember::literal_as_string ==
@@ -760,19 +801,8 @@ namespace daw::json {
 					} else {
 						daw_json_ensure( v > 0, ErrorReason::NumberOutOfRange );
 						char buff[daw::numeric_limits<under_type>::digits10 + 10]{ };
-						char *ptr = buff;
-						while( v >= 10 ) {
-							auto const tmp = static_cast<std::size_t>( v % 100U );
-							v /= 100U;
-							ptr[0] = digits100[tmp][0];
-							ptr[1] = digits100[tmp][1];
-							ptr += 2;
-						}
-						if( v > 0 ) {
-							*ptr++ = static_cast<char>( '0' + static_cast<char>( v ) );
-						}
-						reverse( buff, ptr );
-						it.copy_buffer( buff, ptr );
+						char *const last = buff + std::size( buff );
+						it.copy_buffer( write_digits_backward( last, v ), last );
 					}
 				} else {
 					// Fallback to ADL
@@ -1119,6 +1149,51 @@ namespace daw::json {
 				return it;
 			}
 
+			/// @brief The bytes `,"name":` of a member, built at compile time
+			template<typename JsonMember>
+			struct member_name_prefix {
+				static constexpr std::size_t name_size = std::size( JsonMember::name );
+
+				static constexpr std::array<char, name_size + 4U> value = [] {
+					auto result = std::array<char, name_size + 4U>{ };
+					result[0] = ',';
+					result[1] = '"';
+					for( std::size_t n = 0; n < name_size; ++n ) {
+						result[n + 2U] = std::data( JsonMember::name )[n];
+					}
+					result[name_size + 2U] = '"';
+					result[name_size + 3U] = ':';
+					return result;
+				}( );
+			};
+
+			/// @brief Write the separator before a member and its name.  Minified
+			/// output writes them with a single write of the prefix built at
+			/// compile time, skipping its comma for the first member
+			template<typename JsonMember, typename WriteableType,
+			         json_options_t SerializationOptions>
+			DAW_ATTRIB_INLINE static constexpr void write_member_name(
+			  bool &is_first,
+			  serialization_policy<WriteableType, SerializationOptions> &it ) {
+				using policy_t =
+				  serialization_policy<WriteableType, SerializationOptions>;
+				if constexpr( policy_t::serialization_format ==
+				              options::SerializationFormat::Minified ) {
+					constexpr auto const &prefix =
+					  member_name_prefix<JsonMember>::value;
+					auto const skip = static_cast<std::size_t>( is_first );
+					it.write( daw::string_view( prefix.data( ) + skip,
+					                            prefix.size( ) - skip ) );
+				} else {
+					if( not is_first ) {
+						it.put( ',' );
+					}
+					it.next_member( );
+					it.write( '"', JsonMember::name, "\":", it.space );
+				}
+				is_first = false;
+			}
+
 			template<typename JsonMember, typename WriteableType, typename parse_to_t>
 			[[nodiscard]] static constexpr WriteableType
 			to_json_string_sized_array( WriteableType it, parse_to_t const &value ) {
@@ -1159,17 +1234,15 @@ namespace daw::json {
 					it.next_member( );
 					it.put( '{' );
 					it.add_indent( );
-					it.next_member( );
 					// Append Key Name
-					it.write( "\"", key_t::name, "\":", it.space );
+					bool is_first = true;
+					write_member_name<key_t>( is_first, it );
 					// Append Key Value
 					it = to_daw_json_string<key_t, key_t::expected_type>(
 					  it, json_get_key( *first ) );
 
-					it.put( ',' );
 					// Append Value Name
-					it.next_member( );
-					it.write( "\"", value_t::name, "\":", it.space );
+					write_member_name<value_t>( is_first, it );
 					// Append Value Value
 					it = to_daw_json_string<value_t, value_t::expected_type>(
 					  it, json_get_value( *first ) );
@@ -1386,12 +1459,7 @@ namespace daw::json {
 						return;
 					}
 					visited_members.push_back( dependent_member::name );
-					if( not is_first ) {
-						it.put( ',' );
-					}
-					it.next_member( );
-					is_first = false;
-					it.write( '"', dependent_member::name, "\":", it.space );
+					write_member_name<dependent_member>( is_first, it );
 
 					if constexpr( has_switcher_v<base_member_t> ) {
 						it = member_to_string<dependent_member>(
@@ -1426,12 +1494,7 @@ namespace daw::json {
 						return;
 					}
 				}
-				if( not is_first ) {
-					it.put( ',' );
-				}
-				it.next_member( );
-				is_first = false;
-				it.write( '"', JsonMember::name, "\":", it.space );
+				write_member_name<JsonMember>( is_first, it );
 
 				it = member_to_string<JsonMember>( std::move( it ), get<pos>( tp ) );
 			}
@@ -1557,6 +1620,50 @@ namespace daw::json {
 				}
 				return out_it;
 			}
+
+			/// @brief Output value rounded to Decimals fractional digits.  Values
+			/// too large to scale to a 64bit integer use the shortest decimal form
+			/// @pre value is finite
+			template<unsigned Decimals, typename WriteableType, typename Real>
+			static constexpr WriteableType to_chars_fixed( Real const &value,
+			                                               WriteableType out_it ) {
+				constexpr std::uint64_t scale = [] {
+					std::uint64_t result = 1;
+					for( unsigned n = 0; n < Decimals; ++n ) {
+						result *= 10U;
+					}
+					return result;
+				}( );
+				bool const is_negative = value < 0;
+				double const magnitude = is_negative ? -static_cast<double>( value )
+				                                     : static_cast<double>( value );
+				double const scaled =
+				  magnitude * static_cast<double>( scale ) + 0.5;
+				// 2^64
+				if( scaled >= 18446744073709551616.0 ) {
+					return to_chars( options::FPOutputFormat::Decimal, value, out_it );
+				}
+				auto const units = static_cast<std::uint64_t>( scaled );
+				// Do not output -0.00
+				if( is_negative and units != 0 ) {
+					out_it.put( '-' );
+				}
+				char buff[48]{ };
+				char *const last = buff + std::size( buff );
+				char *first = last;
+				if constexpr( Decimals > 0 ) {
+					first = write_digits_backward( last, units % scale );
+					while( first > last - Decimals ) {
+						*--first = '0';
+					}
+					*--first = '.';
+					first = write_digits_backward( first, units / scale );
+				} else {
+					first = write_digits_backward( last, units );
+				}
+				out_it.copy_buffer( first, last );
+				return out_it;
+			}
 		} // namespace json_details
 	} // namespace DAW_JSON_VER
 } // namespace daw::json
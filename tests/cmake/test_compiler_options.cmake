@@ -2,11 +2,25 @@
 option( DAW_JSON_USE_SANITIZERS "Enable address and undefined sanitizers" OFF )
 option( DAW_WERROR "Enable WError for test builds" OFF )
 option( DAW_ALLOW_SSE42 "EXPERIMENTAL: Enable WError for test builds" OFF )
+option( DAW_ALLOW_AVX2 "EXPERIMENTAL: Enable the AVX2 exec mode, implies DAW_ALLOW_SSE42" OFF )
+option( DAW_ALLOW_AVX512 "EXPERIMENTAL: Enable the AVX512BW exec mode, implies DAW_ALLOW_AVX2" OFF )
+option( DAW_JSON_CPU_DISPATCH "EXPERIMENTAL: Enable the cpu_dispatch exec mode, selecting SIMD kernels at runtime(x86-64)" OFF )
 option( DAW_JSON_COVERAGE "Enable code coverage(gcc/clang)" OFF )
 
+if( DAW_ALLOW_AVX512 )
+    add_compile_definitions( DAW_ALLOW_AVX512 )
+    set( DAW_ALLOW_AVX2 ON )
+endif()
+if( DAW_ALLOW_AVX2 )
+    add_compile_definitions( DAW_ALLOW_AVX2 )
+    set( DAW_ALLOW_SSE42 ON )
+endif()
 if( DAW_ALLOW_SSE42 )
     add_compile_definitions( DAW_ALLOW_SSE42 )
 endif()
+if( DAW_JSON_CPU_DISPATCH )
+    add_compile_definitions( DAW_JSON_CPU_DISPATCH )
+endif()
 if( ${CMAKE_CXX_COMPILER_ID} STREQUAL "Clang" OR ${CMAKE_CXX_COMPILER_ID} STREQUAL "AppleClang" )
     if( MSVC )
         message( STATUS "Clang-CL ${CMAKE_CXX_COMPILER_VERSION} detected" )
@@ -16,12 +16,23 @@
 #include <unordered_map>
 #include <vector>
 
+#if defined( DAW_JSON_TEST_PMR )
+#include <memory_resource>
+#endif
+
 namespace daw::citm {
+#if defined( DAW_JSON_TEST_PMR )
+	template<typename T>
+	using Vector = std::pmr::vector<T>;
+	template<typename K, typename V>
+	using Map = std::pmr::unordered_map<K, V>;
+#else
 	template<typename T>
 	using Vector = std::vector<T, fixed_allocator<T>>;
 	template<typename K, typename V>
 	using Map = std::unordered_map<K, V, std::hash<K>, std::equal_to<K>,
 	                               fixed_allocator<std::pair<K const, V>>>;
+#endif
 
 	struct events_value_t {
 		std::int64_t id;
@@ -17,11 +17,21 @@
 #include <string_view>
 #include <vector>
 
+#if defined( DAW_JSON_TEST_PMR )
+#include <memory_resource>
+#endif
+
 namespace daw::twitter {
+#if defined( DAW_JSON_TEST_PMR )
+	template<typename T>
+	using Vector = std::pmr::vector<T>;
+	using String = std::pmr::string;
+#else
 	template<typename T>
 	using Vector = std::vector<T, daw::fixed_allocator<T>>;
 	using String =
 	  std::basic_string<char, std::char_traits<char>, daw::fixed_allocator<char>>;
+#endif
 	using OptString = std::optional<String>;
 
 	using twitter_tp = std::chrono::time_point<std::chrono::system_clock,
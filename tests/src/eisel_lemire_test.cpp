@@ -0,0 +1,175 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+/// @brief Numbers outside of the exact fast path are converted with
+/// Eisel-Lemire.  Compare the results to strtod/strtof, they must match
+/// exactly with IEEE754Precise and be within 1 ulp without it
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <daw/daw_bit_cast.h>
+#include <daw/daw_ensure.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+template<typename Real>
+Real libc_parse( std::string const &number ) {
+	if constexpr( std::is_same_v<Real, float> ) {
+		return std::strtof( number.c_str( ), nullptr );
+	} else {
+		return std::strtod( number.c_str( ), nullptr );
+	}
+}
+
+template<typename Real, bool KnownBounds, bool Precise>
+Real lib_parse( std::string_view number ) {
+	using namespace daw::json;
+	auto rng = BasicParsePolicy<parse_options(
+	  Precise ? options::IEEE754Precise::yes : options::IEEE754Precise::no )>(
+	  std::data( number ), daw::data_end( number ) );
+	if constexpr( KnownBounds ) {
+		rng = json_details::skip_number( rng );
+	}
+	using json_member = json_details::json_deduced_type<Real>;
+	return json_details::parse_value_real<json_member, KnownBounds>( rng );
+}
+
+template<typename Real>
+auto ulp_diff( Real lhs, Real rhs ) {
+	using bits_t = std::conditional_t<sizeof( Real ) == sizeof( std::uint64_t ),
+	                                  std::uint64_t, std::uint32_t>;
+	auto const l = daw::bit_cast<bits_t>( lhs );
+	auto const r = daw::bit_cast<bits_t>( rhs );
+	return l > r ? l - r : r - l;
+}
+
+template<typename Real, bool KnownBounds, bool Precise>
+void check( std::string const &number ) {
+	auto const expected = libc_parse<Real>( number );
+	auto const result = lib_parse<Real, KnownBounds, Precise>( number );
+	auto const diff = ulp_diff( expected, result );
+	if( diff > ( Precise ? 0U : 1U ) ) {
+		std::cerr << "Mismatch parsing '" << number << "' ulp diff: " << diff
+		          << '\n';
+		std::exit( 1 );
+	}
+}
+
+template<typename Real>
+void check_all( std::string const &number ) {
+	check<Real, false, true>( number );
+	check<Real, true, true>( number );
+	check<Real, false, false>( number );
+	check<Real, true, false>( number );
+}
+
+std::string random_number( std::mt19937_64 &rng ) {
+	auto result = std::string( );
+	if( rng( ) % 2 == 0 ) {
+		result += '-';
+	}
+	auto digit = [&] {
+		return static_cast<char>( '0' + rng( ) % 10U );
+	};
+	// Up to 25 whole digits so some do not fit in 64 bits
+	auto const whole_digits = rng( ) % 26U;
+	if( whole_digits == 0 ) {
+		result += '0';
+	} else {
+		result += static_cast<char>( '1' + rng( ) % 9U );
+		for( std::size_t n = 1; n < whole_digits; ++n ) {
+			result += digit( );
+		}
+	}
+	if( rng( ) % 3 != 0 ) {
+		result += '.';
+		auto const leading_zeros = rng( ) % 4U == 0 ? rng( ) % 20U : 0U;
+		result.append( leading_zeros, '0' );
+		auto const fraction_digits = 1U + rng( ) % 25U;
+		for( std::size_t n = 0; n < fraction_digits; ++n ) {
+			result += digit( );
+		}
+	}
+	if( rng( ) % 2 == 0 ) {
+		result += rng( ) % 2 == 0 ? 'e' : 'E';
+		switch( rng( ) % 3 ) {
+		case 0:
+			result += '-';
+			break;
+		case 1:
+			result += '+';
+			break;
+		default:
+			break;
+		}
+		result += std::to_string( rng( ) % 400U );
+	}
+	return result;
+}
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	constexpr std::string_view edge_cases[] = {
+	  "0",
+	  "-0",
+	  "0e400",
+	  "-0.0E-400",
+	  "1e23",
+	  "8.5e-23",
+	  "9007199254740993",
+	  "9007199254740993.0e10",
+	  "2.2250738585072011e-308",
+	  "2.2250738585072014e-308",
+	  "4.9406564584124654e-324",
+	  "2.4703282292062327e-324",
+	  "2.4703282292062328e-324",
+	  "1.7976931348623157e308",
+	  "1.7976931348623158e308",
+	  "1.7976931348623159e308",
+	  "1e-400",
+	  "1e400",
+	  "3.4028235e38",
+	  "3.4028236e38",
+	  "1.4e-45",
+	  "7.038531e-26",
+	  "0.000000000000000000000000000000000000000000001234",
+	  "123456789012345678901234567890",
+	  "1.00000000000000011102230246251565404236316680908203125",
+	  "1.00000000000000011102230246251565404236316680908203124",
+	  "1.00000000000000011102230246251565404236316680908203126" };
+	for( auto number : edge_cases ) {
+		check_all<double>( std::string( number ) );
+		check_all<float>( std::string( number ) );
+	}
+
+	auto rng = std::mt19937_64( 42 );
+	for( std::size_t n = 0; n < 100'000; ++n ) {
+		auto const number = random_number( rng );
+		check_all<double>( number );
+		check_all<float>( number );
+	}
+	std::cout << "done\n";
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
@@ -0,0 +1,108 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <daw/daw_ensure.h>
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct log_entry {
+	std::string_view message;
+	std::string_view raw;
+	std::string owned;
+};
+
+// Owns its characters like std::string, but is not one
+struct owned_string : std::string {
+	using std::string::string;
+};
+
+struct owned_entry {
+	owned_string text;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<log_entry> {
+		static constexpr char const message[] = "message";
+		static constexpr char const raw[] = "raw";
+		static constexpr char const owned[] = "owned";
+		using type = json_member_list<json_string<message, std::string_view>,
+		                              json_string_raw<raw, std::string_view>,
+		                              json_string<owned>>;
+	};
+
+	template<>
+	struct json_data_contract<owned_entry> {
+		static constexpr char const text[] = "text";
+		using type = json_member_list<json_string<text, owned_string>>;
+	};
+} // namespace daw::json
+
+bool points_into( std::string const &doc, std::string_view sv ) {
+	return sv.data( ) >= doc.data( ) and
+	       sv.data( ) + sv.size( ) <= doc.data( ) + doc.size( );
+}
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	using namespace daw::json;
+	constexpr auto insitu = options::parse_flags<options::InSituStrings::yes>;
+
+	auto doc = std::string(
+	  R"({"message":"a\"b\\c\/d\n\tq\u00e9\ud83d\ude00 end","raw":"x\ny",)"
+	  R"("owned":"o\"k"})" );
+	auto const entry = from_json<log_entry>( doc, insitu );
+	daw_ensure( entry.message == "a\"b\\c/d\n\tq\xC3\xA9\xF0\x9F\x98\x80 end" );
+	daw_ensure( points_into( doc, entry.message ) );
+	// Raw members keep their escapes and owning members are parsed as usual
+	daw_ensure( entry.raw == R"(x\ny)" );
+	daw_ensure( points_into( doc, entry.raw ) );
+	daw_ensure( entry.owned == "o\"k" );
+
+	// Strings without escapes are not changed
+	auto plain = std::string( R"({"message":"plain","raw":"r","owned":"o"})" );
+	auto const plain_copy = plain;
+	auto const plain_entry = from_json<log_entry>( plain, insitu );
+	daw_ensure( plain_entry.message == "plain" );
+	daw_ensure( plain == plain_copy );
+
+	// Only string views decode into the document, other types leave it as is
+	auto owned_doc = std::string( R"({"text":"a\"b\n\u00e9c"})" );
+	auto const owned_copy = owned_doc;
+	auto const owned = from_json<owned_entry>( owned_doc, insitu );
+	daw_ensure( owned.text == "a\"b\n\xC3\xA9" "c" );
+	daw_ensure( owned_doc == owned_copy );
+
+	auto array_doc = std::string( R"([ "a\tb", "", "\\", "no escape" ])" );
+	auto const values =
+	  from_json_array<json_string_no_name<std::string_view>>( array_doc,
+	                                                          insitu );
+	daw_ensure( values ==
+	            std::vector<std::string_view>{ "a\tb", "", "\\", "no escape" } );
+	for( auto sv : values ) {
+		daw_ensure( sv.empty( ) or points_into( array_doc, sv ) );
+	}
+	// The rest of a decoded string, up to its closing quote, is spaces
+	daw_ensure( array_doc == "[ \"a\tb \", \"\", \"\\ \", \"no escape\" ]" );
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
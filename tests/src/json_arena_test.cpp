@@ -0,0 +1,141 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_arena.h>
+#include <daw/json/daw_json_link.h>
+
+#include <daw/daw_ensure.h>
+
+#include <cstdint>
+#include <iostream>
+#include <string_view>
+
+#if defined( DAW_JSON_HAS_ARENA )
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+struct tag_t {
+	std::pmr::string name;
+	std::pmr::vector<std::int64_t> ids;
+};
+
+struct document_t {
+	std::pmr::string title;
+	std::pmr::vector<std::pmr::string> words;
+	std::pmr::vector<tag_t> tags;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<tag_t> {
+		static constexpr char const name[] = "name";
+		static constexpr char const ids[] = "ids";
+		using type =
+		  json_member_list<json_string<name, std::pmr::string>,
+		                   json_array<ids, std::int64_t,
+		                              std::pmr::vector<std::int64_t>>>;
+	};
+
+	template<>
+	struct json_data_contract<document_t> {
+		static constexpr char const title[] = "title";
+		static constexpr char const words[] = "words";
+		static constexpr char const tags[] = "tags";
+		using type = json_member_list<
+		  json_string<title, std::pmr::string>,
+		  json_array<words, std::pmr::string, std::pmr::vector<std::pmr::string>>,
+		  json_array<tags, tag_t, std::pmr::vector<tag_t>>>;
+	};
+} // namespace daw::json
+
+// Long enough to not fit in the small string buffer
+static constexpr std::string_view json_doc = R"({
+	"title": "A title that is longer than any small string buffer",
+	"words": [ "the first word is long enough to allocate", "b", "" ],
+	"tags": [
+		{ "name": "another name that will not fit in place", "ids": [ 1, 2, 3 ] },
+		{ "name": "x", "ids": [ ] }
+	]
+})";
+
+// Every allocation of the result must have come from the arena
+bool uses_arena( document_t const &doc, daw::json::json_arena &arena ) {
+	auto const from_arena = []( auto const &v, daw::json::json_arena &a ) {
+		return v.get_allocator( ).resource( ) == &a;
+	};
+	bool result = from_arena( doc.title, arena ) and
+	              from_arena( doc.words, arena ) and
+	              from_arena( doc.tags, arena );
+	for( auto const &w : doc.words ) {
+		result = result and from_arena( w, arena );
+	}
+	for( auto const &t : doc.tags ) {
+		result = result and from_arena( t.name, arena ) and
+		         from_arena( t.ids, arena );
+	}
+	return result;
+}
+#endif
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+#if defined( DAW_JSON_HAS_ARENA )
+	using namespace daw::json;
+	auto arena = json_arena( );
+	{
+		auto const doc = from_json_arena<document_t>( json_doc, arena );
+		daw_ensure( uses_arena( doc, arena ) );
+		daw_ensure( doc.title ==
+		            "A title that is longer than any small string buffer" );
+		daw_ensure( doc.words.size( ) == 3 );
+		daw_ensure( doc.words[0] == "the first word is long enough to allocate" );
+		daw_ensure( doc.words[2].empty( ) );
+		daw_ensure( doc.tags.size( ) == 2 );
+		daw_ensure( doc.tags[0].name == "another name that will not fit in place" );
+		daw_ensure( doc.tags[0].ids.size( ) == 3 and doc.tags[0].ids[2] == 3 );
+		daw_ensure( doc.tags[1].ids.empty( ) );
+	}
+	auto const allocations = arena.allocation_count( );
+	daw_ensure( allocations > 0 );
+	daw_ensure( arena.bytes_allocated( ) > 0 );
+
+	// Nothing is returned until release, and the count starts over after it
+	arena.release( );
+	daw_ensure( arena.allocation_count( ) == 0 );
+	{
+		auto const doc = from_json_arena<document_t>(
+		  json_doc, arena, options::parse_flags<options::CheckedParseMode::no> );
+		daw_ensure( uses_arena( doc, arena ) );
+		daw_ensure( doc.tags[1].name == "x" );
+	}
+	daw_ensure( arena.allocation_count( ) == allocations );
+
+	// An arena over a stack buffer
+	char buffer[4096];
+	auto stack_arena =
+	  json_arena( buffer, sizeof( buffer ), std::pmr::null_memory_resource( ) );
+	auto const words = from_json_alloc<std::pmr::vector<std::pmr::string>>(
+	  R"([ "a string that is too long to be stored in place", "b" ])",
+	  stack_arena.get_allocator( ) );
+	daw_ensure( words.get_allocator( ).resource( ) == &stack_arena );
+	daw_ensure( words[0].get_allocator( ).resource( ) == &stack_arena );
+	daw_ensure( words[0] == "a string that is too long to be stored in place" );
+#endif
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
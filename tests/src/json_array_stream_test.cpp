@@ -0,0 +1,161 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_array_stream.h>
+#include <daw/json/daw_json_link.h>
+
+#include <daw/daw_ensure.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+struct record {
+	std::int64_t id;
+	std::string name;
+	std::vector<double> values;
+
+	bool operator==( record const &rhs ) const {
+		return std::tie( id, name, values ) ==
+		       std::tie( rhs.id, rhs.name, rhs.values );
+	}
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<record> {
+		static constexpr char const id[] = "id";
+		static constexpr char const name[] = "name";
+		static constexpr char const values[] = "values";
+		using type =
+		  json_member_list<json_number<id, std::int64_t>, json_string<name>,
+		                   json_array<values, double>>;
+	};
+} // namespace daw::json
+
+std::string make_records( std::size_t count ) {
+	std::string result = "[ ";
+	for( std::size_t n = 0; n < count; ++n ) {
+		if( n > 0 ) {
+			result += ",\n";
+		}
+		result += R"({"id":)" + std::to_string( n ) + R"(,"name":"r\"]})" +
+		          std::string( n % 97, 'x' ) + R"(","values":[)";
+		for( std::size_t m = 0; m < n % 13; ++m ) {
+			if( m > 0 ) {
+				result += ',';
+			}
+			result += std::to_string( m ) + ".5";
+		}
+		result += "]}";
+	}
+	result += " ]";
+	return result;
+}
+
+template<typename JsonElement>
+std::vector<daw::json::json_details::from_json_result_t<JsonElement>>
+read_istream( std::string const &doc, std::size_t window_size ) {
+	auto is = std::istringstream( doc );
+	auto stream = daw::json::json_array_stream<JsonElement>( is, window_size );
+	auto result =
+	  std::vector<daw::json::json_details::from_json_result_t<JsonElement>>( );
+	for( auto &&value : stream ) {
+		result.push_back( value );
+	}
+	return result;
+}
+
+template<typename JsonElement>
+void test_same_as_from_json_array( std::string const &doc ) {
+	auto const expected = daw::json::from_json_array<JsonElement>( doc );
+	// Small windows move and grow the window inside of elements
+	for( std::size_t window_size : { 1U, 64U, 100U, 4096U, 1U << 20U } ) {
+		daw_ensure( read_istream<JsonElement>( doc, window_size ) == expected );
+	}
+}
+
+#if defined( DAW_USE_EXCEPTIONS )
+template<typename JsonElement = int>
+bool stream_throws( std::string const &doc ) {
+	try {
+		(void)read_istream<JsonElement>( doc, 64 );
+	} catch( daw::json::json_exception const & ) { return true; }
+	return false;
+}
+#endif
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	auto const records = make_records( 2000 );
+	test_same_as_from_json_array<record>( records );
+	test_same_as_from_json_array<record>( "[]" );
+	test_same_as_from_json_array<record>( make_records( 1 ) );
+	test_same_as_from_json_array<int>( " [ 1,2 , 3,\n-4 ,5] " );
+	test_same_as_from_json_array<bool>( "[true,false,true]" );
+	test_same_as_from_json_array<std::string>( R"(["a","b\"c","","]"])" );
+	test_same_as_from_json_array<std::vector<int>>( "[[1,2],[],[3,4],[5]]" );
+
+	// Memory stays at the window size unless an element is larger than it
+	{
+		auto is = std::istringstream( records );
+		auto stream = daw::json::json_array_stream<record>( is, 4096 );
+		std::size_t count = 0;
+		for( auto it = stream.begin( ); it.good( ); ++it ) {
+			daw_ensure( it->id == static_cast<std::int64_t>( count ) );
+			++count;
+		}
+		daw_ensure( count == 2000 );
+		daw_ensure( stream.window_size( ) == 4096 );
+	}
+
+	// Read from a std::FILE *
+	{
+		std::FILE *f = std::tmpfile( );
+		daw_ensure( f != nullptr );
+		daw_ensure( std::fwrite( records.data( ), 1, records.size( ), f ) ==
+		            records.size( ) );
+		std::rewind( f );
+		auto stream = daw::json::json_array_stream<record>( f, 1000 );
+		auto result = std::vector<record>( stream.begin( ), stream.end( ) );
+		std::fclose( f );
+		daw_ensure( result == daw::json::from_json_array<record>( records ) );
+	}
+
+#if defined( DAW_USE_EXCEPTIONS )
+	for( std::string doc :
+	     { "[1,2", "[1,]", "[1 2]", "{}", "", "[", R"(["abc)", "[1,x]" } ) {
+		daw_ensure( stream_throws( doc ) );
+	}
+	// Elements with trailing garbage before the separator
+	for( std::string doc : { "[12a,3]", "[1,2x]", "[1-2]", "[ 3.5 ]" } ) {
+		daw_ensure( stream_throws( doc ) );
+	}
+	for( std::string doc : { "[truex]", "[true,falsey]", "[nul]" } ) {
+		daw_ensure( stream_throws<bool>( doc ) );
+	}
+	daw_ensure( stream_throws<record>(
+	  R"([{"id":1,"name":"a","values":[]}x])" ) );
+#endif
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
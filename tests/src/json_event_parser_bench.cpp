@@ -0,0 +1,209 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  This benchmarks json_event_parser with the default stack and with a fixed
+//  depth stack, and json_lean_event_parser, on the nativejson benchmark files
+//  and on many small documents
+//
+
+#include "defines.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/daw_read_file.h>
+#include <daw/json/daw_json_event_parser.h>
+#include <daw/json/daw_json_lean_event_parser.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 250;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+// The nesting depth of the benchmark files is less than this
+static constexpr std::size_t max_depth = 32;
+
+struct counting_handler {
+	std::size_t values = 0;
+	std::size_t containers = 0;
+
+	template<daw::json::json_options_t PolicyFlags, typename Allocator>
+	bool handle_on_value( daw::json::basic_json_pair<PolicyFlags, Allocator> ) {
+		++values;
+		return true;
+	}
+
+	bool handle_on_array_end( ) {
+		++containers;
+		return true;
+	}
+
+	bool handle_on_class_end( ) {
+		++containers;
+		return true;
+	}
+};
+
+// Counts the same events as counting_handler
+struct lean_counting_handler {
+	std::size_t values = 0;
+	std::size_t containers = 0;
+
+	void on_class_start( ) {
+		++values;
+	}
+
+	void on_class_end( ) {
+		++containers;
+	}
+
+	void on_array_start( ) {
+		++values;
+	}
+
+	void on_array_end( ) {
+		++containers;
+	}
+
+	void on_string( std::string_view ) {
+		++values;
+	}
+
+	void on_double( double ) {
+		++values;
+	}
+
+	void on_bool( bool ) {
+		++values;
+	}
+
+	void on_null( ) {
+		++values;
+	}
+};
+
+std::size_t count_lean_events( std::string_view json_doc ) {
+	auto handler = lean_counting_handler{ };
+	daw::json::json_lean_event_parser<
+	  daw::json::json_event_parser_max_depth<max_depth>>( json_doc, handler );
+	return handler.values + handler.containers;
+}
+
+template<typename StackContainerPolicy>
+std::size_t count_events( std::string_view json_doc ) {
+	auto handler = counting_handler{ };
+	daw::json::json_event_parser<counting_handler &, StackContainerPolicy>(
+	  json_doc, handler );
+	return handler.values + handler.containers;
+}
+
+template<typename StackContainerPolicy>
+std::size_t count_events( std::vector<daw::json::json_value> const &docs ) {
+	auto handler = counting_handler{ };
+	for( auto const &jv : docs ) {
+		daw::json::json_event_parser<daw::json::json_details::default_policy_flag,
+		                             daw::json::json_details::NoAllocator,
+		                             StackContainerPolicy>( jv, handler );
+	}
+	return handler.values + handler.containers;
+}
+
+void test( std::string_view name, std::string_view json_doc ) {
+	using fixed_depth = daw::json::json_event_parser_max_depth<max_depth>;
+	std::cout << "Processing " << name << ": "
+	          << daw::utility::to_bytes_per_second( json_doc.size( ) ) << '\n';
+	auto const default_count = daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  std::string( name ) + " json_event_parser(default stack)",
+	  json_doc.size( ),
+	  []( std::string_view doc ) {
+		  return count_events<daw::json::use_default>( doc );
+	  },
+	  json_doc );
+	auto const fixed_count = daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  std::string( name ) + " json_event_parser(fixed stack)", json_doc.size( ),
+	  []( std::string_view doc ) {
+		  return count_events<fixed_depth>( doc );
+	  },
+	  json_doc );
+	auto const lean_count = daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  std::string( name ) + " json_lean_event_parser", json_doc.size( ),
+	  []( std::string_view doc ) {
+		  return count_lean_events( doc );
+	  },
+	  json_doc );
+	test_assert( default_count and fixed_count and lean_count and
+	               *default_count == *fixed_count and
+	               *default_count == *lean_count,
+	             "Expected the same events" );
+}
+
+int main( int argc, char **argv )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace daw::json;
+	if( argc < 4 ) {
+		std::cerr << "Must supply a filenames to open\n";
+		std::cerr << "twitter citm canada\n";
+		exit( 1 );
+	}
+	auto const mm_twitter = *daw::read_file( argv[1] );
+	auto const mm_citm = *daw::read_file( argv[2] );
+	auto const mm_canada = *daw::read_file( argv[3] );
+	auto const sv_twitter =
+	  std::string_view( mm_twitter.data( ), mm_twitter.size( ) );
+	auto const sv_citm = std::string_view( mm_citm.data( ), mm_citm.size( ) );
+	auto const sv_canada =
+	  std::string_view( mm_canada.data( ), mm_canada.size( ) );
+
+	test( "twitter", sv_twitter );
+	test( "citm_catalog", sv_citm );
+	test( "canada", sv_canada );
+
+	// Each status is a small document, where the stack is set up each time
+	using fixed_depth = json_event_parser_max_depth<max_depth>;
+	auto const statuses =
+	  from_json<std::vector<json_value>>( sv_twitter, "statuses" );
+	auto const default_count = daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "twitter statuses json_event_parser(default stack)", sv_twitter.size( ),
+	  []( std::vector<json_value> const &docs ) {
+		  return count_events<use_default>( docs );
+	  },
+	  statuses );
+	auto const fixed_count = daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "twitter statuses json_event_parser(fixed stack)", sv_twitter.size( ),
+	  []( std::vector<json_value> const &docs ) {
+		  return count_events<fixed_depth>( docs );
+	  },
+	  statuses );
+	test_assert( default_count and fixed_count and
+	               *default_count == *fixed_count,
+	             "Expected the same events" );
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,158 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_event_parser.h>
+#include <daw/json/daw_json_link.h>
+
+#include <daw/daw_ensure.h>
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Records each event, so that the events with each stack policy can be
+// compared
+struct recording_handler {
+	std::vector<std::string> events{ };
+
+	daw::json::json_parse_handler_result add( std::string event ) {
+		events.push_back( std::move( event ) );
+		return daw::json::json_parse_handler_result::Continue;
+	}
+
+	template<daw::json::json_options_t PolicyFlags, typename Allocator>
+	daw::json::json_parse_handler_result
+	handle_on_value( daw::json::basic_json_pair<PolicyFlags, Allocator> p ) {
+		return add( "value " + std::string( p.name.value_or( "" ) ) );
+	}
+
+	template<daw::json::json_options_t PolicyFlags, typename Allocator>
+	daw::json::json_parse_handler_result handle_on_array_start(
+	  daw::json::basic_json_value<PolicyFlags, Allocator> ) {
+		return add( "[" );
+	}
+
+	daw::json::json_parse_handler_result handle_on_array_end( ) {
+		return add( "]" );
+	}
+
+	template<daw::json::json_options_t PolicyFlags, typename Allocator>
+	daw::json::json_parse_handler_result handle_on_class_start(
+	  daw::json::basic_json_value<PolicyFlags, Allocator> ) {
+		return add( "{" );
+	}
+
+	daw::json::json_parse_handler_result handle_on_class_end( ) {
+		return add( "}" );
+	}
+
+	daw::json::json_parse_handler_result handle_on_number( double d ) {
+		return add( "number " + std::to_string( d ) );
+	}
+
+	daw::json::json_parse_handler_result handle_on_bool( bool b ) {
+		return add( b ? "true" : "false" );
+	}
+
+	daw::json::json_parse_handler_result
+	handle_on_string( std::string const &s ) {
+		return add( "string " + s );
+	}
+
+	daw::json::json_parse_handler_result handle_on_null( ) {
+		return add( "null" );
+	}
+};
+
+// The nesting limit is known from the handler, so the stack is fixed by
+// default
+struct depth_limited_handler : recording_handler {
+	static constexpr std::size_t max_nesting_depth = 4;
+};
+
+static constexpr std::string_view json_doc = R"( {
+	"a": [ 1, -2.5e+10, true, false, null, "x\\\"y" ],
+	"c": { "d": { }, "e": [ ] },
+	"f": [ [ [ "q" ] ], 0 ]
+} )";
+
+// The deepest value of json_doc is inside four classes and arrays
+static constexpr std::size_t json_doc_depth = 4;
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	using namespace daw::json;
+	auto expected_handler = recording_handler{ };
+	json_event_parser( json_doc, expected_handler );
+	auto const &expected = expected_handler.events;
+
+	// The handler type can still be the only template argument
+	auto explicit_handler = recording_handler{ };
+	json_event_parser<recording_handler &>( json_doc, explicit_handler );
+	daw_ensure( explicit_handler.events == expected );
+
+	auto fixed_handler = recording_handler{ };
+	json_event_parser<recording_handler &,
+	                  json_event_parser_max_depth<json_doc_depth>>(
+	  json_doc, fixed_handler );
+	daw_ensure( fixed_handler.events == expected );
+
+	auto limited_handler = depth_limited_handler{ };
+	json_event_parser( json_doc, limited_handler );
+	daw_ensure( limited_handler.events == expected );
+
+	auto unchecked_handler = recording_handler{ };
+	json_event_parser<recording_handler &, json_event_parser_max_depth<16>>(
+	  json_doc, unchecked_handler,
+	  options::parse_flags<options::CheckedParseMode::no> );
+	daw_ensure( unchecked_handler.events == expected );
+
+	// A json_value keeps the policy too
+	auto value_handler = recording_handler{ };
+	json_event_parser<json_details::default_policy_flag,
+	                  json_details::NoAllocator,
+	                  json_event_parser_max_depth<json_doc_depth>>(
+	  json_value( json_doc ), value_handler );
+	daw_ensure( value_handler.events == expected );
+
+	// A root value that is not a class or array needs no stack
+	auto root_handler = recording_handler{ };
+	json_event_parser<recording_handler &, json_event_parser_max_depth<1>>(
+	  "1234", root_handler );
+	daw_ensure( root_handler.events.size( ) == 2 );
+
+#if defined( DAW_USE_EXCEPTIONS )
+	for( std::string_view doc :
+	     { json_doc, std::string_view( "[[[[[1]]]]]" ),
+	       std::string_view( R"({"a":{"b":[{"c":[]}]}})" ) } ) {
+		bool has_thrown = false;
+		try {
+			auto handler = recording_handler{ };
+			json_event_parser<recording_handler &,
+			                  json_event_parser_max_depth<json_doc_depth - 1>>(
+			  doc, handler );
+		} catch( json_exception const &jex ) {
+			has_thrown = jex.reason_type( ) == ErrorReason::MaxNestingDepthExceeded;
+		}
+		daw_ensure( has_thrown );
+	}
+#endif
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
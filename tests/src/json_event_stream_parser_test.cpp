@@ -0,0 +1,172 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_event_parser.h>
+#include <daw/json/daw_json_event_stream_parser.h>
+#include <daw/json/daw_json_link.h>
+
+#include <daw/daw_ensure.h>
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Records each event with the decoded values, so that the events of
+// json_event_parser and json_event_stream_parser can be compared
+struct recording_handler {
+	std::vector<std::string> events{ };
+	std::string complete_after{ };
+
+	daw::json::json_parse_handler_result add( std::string event ) {
+		events.push_back( std::move( event ) );
+		if( events.back( ) == complete_after ) {
+			return daw::json::json_parse_handler_result::Complete;
+		}
+		return daw::json::json_parse_handler_result::Continue;
+	}
+
+	template<daw::json::json_options_t PolicyFlags, typename Allocator>
+	daw::json::json_parse_handler_result
+	handle_on_value( daw::json::basic_json_pair<PolicyFlags, Allocator> p ) {
+		return add( "value " + std::string( p.name.value_or( "" ) ) );
+	}
+
+	template<daw::json::json_options_t PolicyFlags, typename Allocator>
+	daw::json::json_parse_handler_result handle_on_array_start(
+	  daw::json::basic_json_value<PolicyFlags, Allocator> ) {
+		return add( "[" );
+	}
+
+	daw::json::json_parse_handler_result handle_on_array_end( ) {
+		return add( "]" );
+	}
+
+	template<daw::json::json_options_t PolicyFlags, typename Allocator>
+	daw::json::json_parse_handler_result handle_on_class_start(
+	  daw::json::basic_json_value<PolicyFlags, Allocator> ) {
+		return add( "{" );
+	}
+
+	daw::json::json_parse_handler_result handle_on_class_end( ) {
+		return add( "}" );
+	}
+
+	daw::json::json_parse_handler_result handle_on_number( double d ) {
+		return add( "number " + std::to_string( d ) );
+	}
+
+	daw::json::json_parse_handler_result handle_on_bool( bool b ) {
+		return add( b ? "true" : "false" );
+	}
+
+	daw::json::json_parse_handler_result
+	handle_on_string( std::string const &s ) {
+		return add( "string " + s );
+	}
+
+	daw::json::json_parse_handler_result handle_on_null( ) {
+		return add( "null" );
+	}
+};
+
+static constexpr std::string_view json_doc = R"( {
+	"a\"b": [ 1, -2.5e+10, true, false, null, "x\\\"yé\n" ],
+	"c": { "d": { }, "e": [ ] },
+	"long_member_name": 1234567890.0987654321,
+	"f": [ [ [ "q" ] ], 0 ]
+} )";
+
+// Push the document in the pieces between the split points, overwriting each
+// piece afterwards so nothing can point into it
+std::vector<std::string> stream_events( std::string_view doc,
+                                        std::vector<std::size_t> const &splits,
+                                        std::string complete_after = "" ) {
+	auto handler = recording_handler{ };
+	handler.complete_after = std::move( complete_after );
+	auto parser = daw::json::json_event_stream_parser( handler );
+	std::size_t prev = 0;
+	for( std::size_t split : splits ) {
+		auto chunk = std::string( doc.substr( prev, split - prev ) );
+		parser.push( chunk );
+		chunk.assign( chunk.size( ), '#' );
+		prev = split;
+	}
+	auto chunk = std::string( doc.substr( prev ) );
+	parser.push( chunk );
+	chunk.assign( chunk.size( ), '#' );
+	parser.finish( );
+	daw_ensure( parser.is_complete( ) );
+	return handler.events;
+}
+
+#if defined( DAW_USE_EXCEPTIONS )
+bool stream_throws( std::string_view doc ) {
+	for( std::size_t split = 0; split <= doc.size( ); ++split ) {
+		try {
+			(void)stream_events( doc, { split } );
+			return false;
+		} catch( daw::json::json_exception const & ) {}
+	}
+	return true;
+}
+#endif
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	auto expected_handler = recording_handler{ };
+	daw::json::json_event_parser( json_doc, expected_handler );
+	auto const &expected = expected_handler.events;
+
+	// Every way of splitting the document in up to three pieces, which puts a
+	// boundary inside every string, escape, number, and literal
+	for( std::size_t i = 0; i <= json_doc.size( ); ++i ) {
+		for( std::size_t j = i; j <= json_doc.size( ); ++j ) {
+			daw_ensure( stream_events( json_doc, { i, j } ) == expected );
+		}
+	}
+	auto every_byte = std::vector<std::size_t>( );
+	for( std::size_t n = 1; n < json_doc.size( ); ++n ) {
+		every_byte.push_back( n );
+	}
+	daw_ensure( stream_events( json_doc, every_byte ) == expected );
+
+	// A root number has no delimiter, it ends with finish
+	for( std::string_view doc : { "12345", "-1.5e3 ", "true", R"("\"")" } ) {
+		auto root_handler = recording_handler{ };
+		daw::json::json_event_parser( doc, root_handler );
+		for( std::size_t split = 0; split <= doc.size( ); ++split ) {
+			daw_ensure( stream_events( doc, { split } ) == root_handler.events );
+		}
+	}
+
+	// The handler can stop the parse, the rest of the input is ignored
+	auto const stopped = stream_events( json_doc, { 40 }, "true" );
+	daw_ensure( stopped.back( ) == "true" );
+	daw_ensure( stopped.size( ) < expected.size( ) );
+
+#if defined( DAW_USE_EXCEPTIONS )
+	for( std::string_view doc :
+	     { "[1,2", "[1,]", R"({"a" 1})", R"({"a":1,})", "[1 2]", "[}", "tru",
+	       "truex", "1 2", "{1:2}", "", R"(["abc)", R"({"a":)" } ) {
+		daw_ensure( stream_throws( doc ) );
+	}
+#endif
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
@@ -0,0 +1,250 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_lean_event_parser.h>
+#include <daw/json/daw_json_link.h>
+
+#include <daw/daw_ensure.h>
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Records each event, and returns SkipClassArray or Complete for the chosen
+// ones
+struct recording_handler {
+	std::vector<std::string> events{ };
+	std::string skip_key{ };
+	std::string skip_after{ };
+	std::string complete_after{ };
+
+	daw::json::json_parse_handler_result add( std::string event ) {
+		events.push_back( std::move( event ) );
+		if( events.back( ) == complete_after ) {
+			return daw::json::json_parse_handler_result::Complete;
+		}
+		if( events.back( ) == skip_after ) {
+			return daw::json::json_parse_handler_result::SkipClassArray;
+		}
+		return daw::json::json_parse_handler_result::Continue;
+	}
+
+	daw::json::json_parse_handler_result on_class_start( ) {
+		return add( "{" );
+	}
+
+	daw::json::json_parse_handler_result on_class_end( ) {
+		return add( "}" );
+	}
+
+	void on_array_start( ) {
+		events.push_back( "[" );
+	}
+
+	bool on_array_end( ) {
+		events.push_back( "]" );
+		return true;
+	}
+
+	daw::json::json_parse_handler_result on_key( std::string_view name ) {
+		events.push_back( "key " + std::string( name ) );
+		if( name == skip_key ) {
+			return daw::json::json_parse_handler_result::SkipClassArray;
+		}
+		return daw::json::json_parse_handler_result::Continue;
+	}
+
+	daw::json::json_parse_handler_result on_string( std::string_view str,
+	                                                bool needs_unescape ) {
+		return add( ( needs_unescape ? "escaped " : "string " ) +
+		            std::string( str ) );
+	}
+
+	daw::json::json_parse_handler_result on_int64( std::int64_t i ) {
+		return add( "int64 " + std::to_string( i ) );
+	}
+
+	daw::json::json_parse_handler_result on_uint64( std::uint64_t u ) {
+		return add( "uint64 " + std::to_string( u ) );
+	}
+
+	daw::json::json_parse_handler_result on_double( double d ) {
+		return add( "double " + std::to_string( d ) );
+	}
+
+	daw::json::json_parse_handler_result on_bool( bool b ) {
+		return add( b ? "true" : "false" );
+	}
+
+	void on_null( ) {
+		events.push_back( "null" );
+	}
+};
+
+// Only numbers, which all go to on_double
+struct double_handler {
+	std::vector<double> values{ };
+
+	void on_double( double d ) {
+		values.push_back( d );
+	}
+};
+
+// The string events of json_event_parser, to compare with
+struct string_count_handler {
+	std::size_t count = 0;
+
+	bool handle_on_string( std::string const & ) {
+		++count;
+		return true;
+	}
+
+	void on_string( std::string_view ) {
+		++count;
+	}
+};
+
+struct empty_handler {};
+
+static constexpr std::string_view json_doc = R"( {
+	"a": [ 1, -2, 3.5, 1e2, true, false, null, "x\"y", "plain" ],
+	"b": { "c": { }, "d": [ ] },
+	"uint64_max": 18446744073709551615,
+	"int64_min": -9223372036854775808,
+	"too_large": 18446744073709551616
+} )";
+
+std::vector<std::string> lean_events( std::string_view doc,
+                                      recording_handler handler ) {
+	daw::json::json_lean_event_parser( doc, handler );
+	return handler.events;
+}
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	using namespace daw::json;
+	using events_t = std::vector<std::string>;
+	auto const all_events = lean_events( json_doc, recording_handler{ } );
+	daw_ensure(
+	  all_events ==
+	  events_t{ "{",
+	            "key a",
+	            "[",
+	            "int64 1",
+	            "int64 -2",
+	            "double " + std::to_string( 3.5 ),
+	            "double " + std::to_string( 100.0 ),
+	            "true",
+	            "false",
+	            "null",
+	            R"(escaped x\"y)",
+	            "string plain",
+	            "]",
+	            "key b",
+	            "{",
+	            "key c",
+	            "{",
+	            "}",
+	            "key d",
+	            "[",
+	            "]",
+	            "}",
+	            "key uint64_max",
+	            "uint64 18446744073709551615",
+	            "key int64_min",
+	            "int64 -9223372036854775808",
+	            "key too_large",
+	            "double " + std::to_string( 18446744073709551616.0 ),
+	            "}" } );
+
+	// The same events with a fixed depth stack and unchecked parsing
+	auto fixed_handler = recording_handler{ };
+	json_lean_event_parser<json_event_parser_max_depth<3>>(
+	  json_doc, fixed_handler,
+	  options::parse_flags<options::CheckedParseMode::no> );
+	daw_ensure( fixed_handler.events == all_events );
+
+	// SkipClassArray from on_key skips the member's value
+	auto skip_key_handler = recording_handler{ };
+	skip_key_handler.skip_key = "a";
+	auto const skip_key_events = lean_events( json_doc, skip_key_handler );
+	daw_ensure( skip_key_events[1] == "key a" and
+	            skip_key_events[2] == "key b" );
+
+	// SkipClassArray from a value skips the rest of the array, but not its end
+	auto skip_rest_handler = recording_handler{ };
+	skip_rest_handler.skip_after = "int64 1";
+	auto const skip_rest_events = lean_events( json_doc, skip_rest_handler );
+	daw_ensure( skip_rest_events[3] == "int64 1" and
+	            skip_rest_events[4] == "]" and
+	            skip_rest_events[5] == "key b" );
+
+	// SkipClassArray from on_class_start skips that class
+	auto skip_class_handler = recording_handler{ };
+	skip_class_handler.skip_after = "{";
+	daw_ensure( lean_events( json_doc, skip_class_handler ) == events_t{ "{" } );
+
+	// Complete stops parsing
+	auto complete_handler = recording_handler{ };
+	complete_handler.complete_after = "true";
+	auto const complete_events = lean_events( json_doc, complete_handler );
+	daw_ensure( complete_events.back( ) == "true" and
+	            complete_events.size( ) == 8 );
+
+	// Numbers go to on_double when there are no integer events
+	auto doubles = double_handler{ };
+	json_lean_event_parser( json_doc, doubles );
+	daw_ensure( doubles.values.size( ) == 7 );
+	daw_ensure( doubles.values[1] == -2.0 and doubles.values[3] == 100.0 );
+
+	auto lean_strings = string_count_handler{ };
+	json_lean_event_parser( json_doc, lean_strings );
+	auto strings = string_count_handler{ };
+	json_event_parser( json_doc, strings );
+	daw_ensure( lean_strings.count == strings.count and strings.count == 2 );
+
+	// Without any events the document is only validated
+	json_lean_event_parser( json_doc, empty_handler{ } );
+	daw_ensure( lean_events( " 42 ", recording_handler{ } ) ==
+	            events_t{ "int64 42" } );
+
+#if defined( DAW_USE_EXCEPTIONS )
+	for( std::string_view bad :
+	     { "[1,2", "[1,]", R"({"a" 1})", R"({"a":1,})", "[1 2]", "{]", "", "tru",
+	       "{1:2}", R"(["abc)", "[}" } ) {
+		bool has_thrown = false;
+		try {
+			(void)lean_events( bad, recording_handler{ } );
+		} catch( json_exception const & ) { has_thrown = true; }
+		daw_ensure( has_thrown );
+	}
+	bool has_thrown = false;
+	try {
+		auto handler = recording_handler{ };
+		json_lean_event_parser(
+		  "1 2", handler,
+		  options::parse_flags<options::MustVerifyEndOfDataIsValid::yes> );
+	} catch( json_exception const &jex ) {
+		has_thrown = jex.reason_type( ) == ErrorReason::InvalidEndOfValue;
+	}
+	daw_ensure( has_thrown );
+#endif
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
@@ -17,12 +17,16 @@
 #include <daw/daw_memory_mapped_file.h>
 #include <daw/json/daw_json_lines_iterator.h>
 #include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_parallel_lines.h>
 
+#include <algorithm>
 #include <cstdlib>
 #include <future>
 #include <iostream>
 #include <numeric>
+#include <string>
 #include <thread>
+#include <vector>
 
 #if not defined( DAW_NUM_RUNS )
 #if not defined( DEBUG ) or defined( NDEBUG )
@@ -175,4 +179,35 @@ int main( int argc, char **argv ) {
 	  unchkpartitions );
 	ensure( typed_unchecked_threaded_count.has_value( ) );
 	ensure( typed_unchecked_threaded_count.get( ) == real_count.get( ) );
+
+	// Scaling of the work stealing executor with the number of threads
+	auto const max_threads =
+	  std::max( std::thread::hardware_concurrency( ), 1U );
+	auto thread_counts = std::vector<unsigned>( );
+	for( unsigned n = 1; n < max_threads; n *= 2U ) {
+		thread_counts.push_back( n );
+	}
+	thread_counts.push_back( max_threads );
+	for( unsigned thread_count : thread_counts ) {
+		auto const lines = daw::json::parallel_json_lines<
+		  jsonl_entry, daw::json::options::CheckedParseMode::no>(
+		  jsonl_doc, daw::json::parallel_json_lines_options{ thread_count } );
+		auto parallel_count = daw::json::benchmark::benchmark(
+		  DAW_NUM_RUNS * 10, jsonl_doc.size( ),
+		  "parallel_json_lines typed unchecked " +
+		    std::to_string( thread_count ) + " threads",
+		  []( auto const &pl ) {
+			  return pl.reduce(
+			    std::size_t{ 0 },
+			    []( jsonl_entry const &entry ) {
+				    return entry.body.size( );
+			    },
+			    []( std::size_t lhs, std::size_t rhs ) {
+				    return lhs + rhs;
+			    } );
+		  },
+		  lines );
+		ensure( parallel_count.has_value( ) );
+		ensure( parallel_count.get( ) == real_count.get( ) );
+	}
 }
@@ -0,0 +1,137 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_apply.h>
+#include <daw/json/daw_json_link.h>
+
+#include <daw/daw_ensure.h>
+
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+static constexpr std::string_view json_doc = R"({
+	"id": 12345,
+	"user": {
+		"name": "some name",
+		"tags": [ "a", "b", { "deep": [ 1, 2, 3 ] } ]
+	},
+	"items": [
+		{ "id": 1, "price": 1.5 },
+		{ "id": 2, "price": 2.5 }
+	],
+	"a/b": { "m~n": 7, "0": "zero" },
+	"dotted.name": true,
+	"matrix": [ [ 1, 2 ], [ 3, 4 ] ]
+})";
+
+static constexpr char const user_name[] = "user.name";
+static constexpr char const deep[] = "user.tags[2].deep[1]";
+static constexpr char const item_price[] = "items[1].price";
+static constexpr char const cell[] = "matrix[1][0]";
+static constexpr char const dotted[] = "dotted\\.name";
+static constexpr char const missing[] = "user.tags[4]";
+static constexpr char const ptr_deep[] = "/user/tags/2/deep/1";
+static constexpr char const ptr_escaped[] = "/a~1b/m~0n";
+static constexpr char const ptr_digits[] = "/a~1b/0";
+static constexpr char const ptr_cell[] = "/matrix/1/0";
+static constexpr char const ptr_root[] = "";
+static constexpr char const ptr_row[] = "/matrix/1";
+static constexpr char const ptr_missing[] = "/items/5";
+
+// The compile time path must find the same value as the runtime path
+template<typename Path>
+void test_same_member( Path path, std::string_view runtime_path ) {
+	using namespace daw::json;
+	auto const root = json_value( json_doc );
+	auto const found = root.find_member( path );
+	auto const expected = root.find_member( runtime_path );
+	daw_ensure( static_cast<bool>( found ) == static_cast<bool>( expected ) );
+	if( expected ) {
+		daw_ensure( found.get_raw_state( ).first ==
+		            expected.get_raw_state( ).first );
+	}
+}
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	using namespace daw::json;
+	static_assert( json_path<deep>::parsed.size == 5 );
+	static_assert( json_path<deep>::parsed.segments[2].is_index );
+	static_assert( json_path<deep>::parsed.segments[4].index == 1 );
+	static_assert( json_pointer<ptr_escaped>::parsed.name(
+	                 json_pointer<ptr_escaped>::parsed.segments[1] ) == "m~n" );
+
+	test_same_member( json_path<user_name>{ }, user_name );
+	test_same_member( json_path<deep>{ }, deep );
+	test_same_member( json_path<item_price>{ }, item_price );
+	test_same_member( json_path<cell>{ }, cell );
+	test_same_member( json_path<dotted>{ }, dotted );
+	test_same_member( json_path<missing>{ }, missing );
+	test_same_member( json_pointer<ptr_deep>{ }, deep );
+	test_same_member( json_pointer<ptr_cell>{ }, cell );
+	test_same_member( json_pointer<ptr_missing>{ }, "items[5]" );
+
+	daw_ensure( from_json<std::string>( json_doc, json_path<user_name>{ } ) ==
+	            "some name" );
+	daw_ensure( from_json<int>( json_doc, json_path<deep>{ } ) ==
+	            from_json<int>( json_doc, deep ) );
+	daw_ensure( from_json<double>( json_doc, json_path<item_price>{ } ) == 2.5 );
+	daw_ensure( from_json<bool>( json_doc, json_path<dotted>{ } ) );
+	daw_ensure( from_json<int>( json_doc, json_pointer<ptr_escaped>{ } ) == 7 );
+	daw_ensure( from_json<std::string>( json_doc, json_pointer<ptr_digits>{ },
+	                                    options::parse_flags<
+	                                      options::CheckedParseMode::no> ) ==
+	            "zero" );
+	daw_ensure( from_json<int>( json_doc, json_pointer<ptr_cell>{ } ) == 3 );
+	daw_ensure( not from_json<std::optional<int>>( json_doc,
+	                                                json_path<missing>{ } ) );
+	test_same_member( json_pointer<ptr_root>{ }, "" );
+
+	auto const total = json_apply(
+	  json_doc, json_pointer<ptr_row>{ }, []( std::vector<int> const &v ) {
+		  std::int64_t result = 0;
+		  for( auto i : v ) {
+			  result += i;
+		  }
+		  return result;
+	  } );
+	daw_ensure( total == 7 );
+
+#if defined( DAW_JSON_CNTTP_JSON_NAME )
+	daw_ensure( from_json<std::int64_t>( json_doc, json_path<"id">{ } ) ==
+	            12345 );
+	daw_ensure( from_json<std::string>(
+	              json_doc, json_pointer<"/user/tags/1">{ } ) == "b" );
+	test_same_member( json_path<"items[0].id">{ }, "items[0].id" );
+#endif
+
+#if defined( DAW_USE_EXCEPTIONS )
+	bool has_thrown = false;
+	try {
+		(void)from_json<int>( json_doc, json_path<missing>{ } );
+	} catch( json_exception const &jex ) {
+		has_thrown = jex.reason_type( ) == ErrorReason::JSONPathNotFound;
+	}
+	daw_ensure( has_thrown );
+#endif
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
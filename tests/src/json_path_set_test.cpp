@@ -0,0 +1,117 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_path_set.h>
+
+#include <daw/daw_ensure.h>
+
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+static constexpr std::string_view json_doc = R"({
+	"id": 12345,
+	"user": {
+		"name": "some name",
+		"tags": [ "a", "b", { "deep": [ 1, 2, 3 ] } ],
+		"skipped": { "x": [ { }, [ ], "}" ] }
+	},
+	"items": [
+		{ "id": 1, "price": 1.5 },
+		{ "id": 2, "price": 2.5 },
+		{ "id": 3, "price": 3.5 }
+	],
+	"dotted.name": true,
+	"matrix": [ [ 1, 2 ], [ 3, 4 ] ]
+})";
+
+static constexpr std::string_view paths[] = {
+  "id",           "user.name",        "user.tags[2].deep[1]",
+  "items[1].id",  "items[2].price",   "items[1].price",
+  "matrix[1][0]", "dotted\\.name",    "user.missing",
+  "items[7].id",  "user.tags[0]",     "id" };
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	using namespace daw::json;
+	auto const path_set = json_path_set( paths );
+	daw_ensure( path_set.size( ) == std::size( paths ) );
+
+	// Every path that is found must be the same value find_member finds
+	auto const values = find_json_paths( json_doc, path_set );
+	daw_ensure( values.size( ) == std::size( paths ) );
+	auto const root = json_value( json_doc );
+	for( std::size_t n = 0; n < values.size( ); ++n ) {
+		auto const expected = root.find_member( paths[n] );
+		daw_ensure( static_cast<bool>( values[n] ) ==
+		            static_cast<bool>( expected ) );
+		if( expected ) {
+			daw_ensure( values[n].get_raw_state( ).first ==
+			            expected.get_raw_state( ).first );
+		}
+	}
+	daw_ensure( not values[8] and not values[9] );
+
+	auto const [id, name, deep, item_id, price2, price1, cell, dotted,
+	            missing, missing_item, tag, id2] =
+	  from_json_paths<std::int64_t, std::string, int, int, double, double, int,
+	                  bool, std::optional<int>, std::optional<int>, std::string,
+	                  std::int64_t>( json_doc, path_set );
+	daw_ensure( id == 12345 and id2 == 12345 );
+	daw_ensure( name == "some name" );
+	daw_ensure( deep == 2 );
+	daw_ensure( item_id == 2 );
+	daw_ensure( price1 == 1.5 and price2 == 2.5 );
+	daw_ensure( cell == 3 );
+	daw_ensure( dotted );
+	daw_ensure( not missing and not missing_item );
+	daw_ensure( tag == "a" );
+
+	// Paths given in place, with parse options
+	auto const [user_name, first_price] =
+	  from_json_paths<std::string_view, double>(
+	    json_doc, { "user.name", "items[0].price" },
+	    options::parse_flags<options::CheckedParseMode::no> );
+	daw_ensure( user_name == "some name" and first_price == 1.5 );
+
+	// The root can be an array, and the whole document is the empty path
+	auto const [second, whole] = from_json_paths<int, std::vector<int>>(
+	  std::string_view( "[ 5, 6, 7 ]" ), { "[1]", "" } );
+	daw_ensure( second == 6 and whole.size( ) == 3 );
+
+	// Nothing after the last path is read
+	auto const truncated = std::string( json_doc.substr( 0, 60 ) ) + "!@#";
+	auto const [early_id, early_name] = from_json_paths<int, std::string>(
+	  truncated, { "id", "user.name" } );
+	daw_ensure( early_id == 12345 and early_name == "some name" );
+
+#if defined( DAW_USE_EXCEPTIONS )
+	bool has_thrown = false;
+	try {
+		(void)from_json_paths<int>( json_doc, { "user.missing" } );
+	} catch( json_exception const &jex ) {
+		has_thrown = jex.reason_type( ) == ErrorReason::JSONPathNotFound;
+	}
+	daw_ensure( has_thrown );
+#endif
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
@@ -0,0 +1,105 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <daw/daw_ensure.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+struct record {
+	std::int64_t id;
+	std::string name;
+	std::vector<double> values;
+	std::optional<bool> flag;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<record> {
+		static constexpr char const id[] = "id";
+		static constexpr char const name[] = "name";
+		static constexpr char const values[] = "values";
+		static constexpr char const flag[] = "flag";
+		using type =
+		  json_member_list<json_number<id, std::int64_t>, json_string<name>,
+		                   json_array<values, double>, json_bool_null<flag>>;
+
+		static constexpr auto to_json_data( record const &r ) {
+			return std::forward_as_tuple( r.id, r.name, r.values, r.flag );
+		}
+	};
+} // namespace daw::json
+
+template<typename Value, typename... Flags>
+void test_size( Value const &value, Flags... flags ) {
+	auto const json = daw::json::to_json( value, flags... );
+	daw_ensure( daw::json::json_serialized_size( value, flags... ) ==
+	            json.size( ) );
+}
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	using namespace daw::json;
+	auto records = std::vector<record>( );
+	for( std::int64_t n = 0; n < 1000; ++n ) {
+		auto r = record{ n * -7919, "name \"" + std::to_string( n ) + "\"\n",
+		                 { }, std::nullopt };
+		for( std::int64_t m = 0; m < n % 5; ++m ) {
+			r.values.push_back( static_cast<double>( n ) / 3.0 +
+			                    static_cast<double>( m ) );
+		}
+		if( n % 3 == 0 ) {
+			r.flag = n % 2 == 0;
+		}
+		records.push_back( std::move( r ) );
+	}
+
+	test_size( records.front( ) );
+	test_size( records.back( ),
+	           options::output_flags<options::SerializationFormat::Pretty> );
+	test_size( std::string( "Bücher \x01 \\ \"" ) );
+	test_size( std::string( "Bücher 😍" ),
+	           options::output_flags<
+	             options::RestrictedStringOutput::OnlyAllow7bitsStrings> );
+	test_size( 1.0 / 3.0 );
+	test_size( std::int64_t{ -1234567890123 } );
+
+	auto const array_json = to_json_array( records );
+	std::size_t const array_size = json_array_serialized_size( records );
+	daw_ensure( array_size == array_json.size( ) );
+	daw_ensure(
+	  json_array_serialized_size(
+	    records, options::output_flags<options::SerializationFormat::Pretty> ) ==
+	  to_json_array( records,
+	                 options::output_flags<options::SerializationFormat::Pretty> )
+	    .size( ) );
+
+	// Size the buffer once and serialize into it without size checks
+	auto buffer = std::string( array_size, '\0' );
+	char *out = buffer.data( );
+	out = to_json_array( records, out );
+	daw_ensure( out == buffer.data( ) + array_size );
+	daw_ensure( buffer == array_json );
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
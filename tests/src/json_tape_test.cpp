@@ -0,0 +1,132 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_tape.h>
+
+#include <daw/daw_ensure.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+static constexpr std::string_view json_doc = R"({
+	"id": 12345,
+	"name": "some \"quoted\" name",
+	"flags": [ true, false, null ],
+	"empty_array": [ ],
+	"empty_class": { },
+	"nested": { "a": [ 1, [ 2, 3 ], { "b": -1.5e3 } ], "c": "d" },
+	"dotted.name": 1,
+	"id": 54321
+})";
+
+// The tape must see the same values as json_value does
+void test_same( daw::json::json_tape_value tv, daw::json::json_value jv ) {
+	daw_ensure( tv.type( ) == jv.type( ) );
+	daw_ensure( tv.get_raw_state( ).first == jv.get_raw_state( ).first );
+	if( tv.is_class( ) or tv.is_array( ) ) {
+		auto jv_first = jv.begin( );
+		std::size_t count = 0;
+		for( auto [name, value] : tv ) {
+			daw_ensure( jv_first != jv.end( ) );
+			daw_ensure( name == jv_first.name( ) );
+			test_same( value, jv_first.value( ) );
+			++jv_first;
+			++count;
+		}
+		daw_ensure( jv_first == jv.end( ) );
+		daw_ensure( count == tv.size( ) );
+	} else if( not tv.is_null( ) ) {
+		daw_ensure( tv.get_string_view( ) == jv.get_string_view( ) );
+	}
+}
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	using namespace daw::json;
+	auto const tape = json_tape( json_doc );
+	auto const root = tape.root( );
+	test_same( root, json_value( json_doc ) );
+
+	for( auto path : { "id", "name", "flags[1]", "flags[3]", "empty_class",
+	                   "nested.a[1][0]", "nested.a[2].b", "nested.c",
+	                   "dotted\\.name", "missing", "nested.a[5]" } ) {
+		auto const tv = root.find_member( path );
+		auto const jv = json_value( json_doc ).find_member( path );
+		daw_ensure( static_cast<bool>( tv ) == static_cast<bool>( jv ) );
+		if( jv ) {
+			test_same( tv, jv );
+		}
+	}
+
+	// The first member of a name is found, as json_value finds it
+	daw_ensure( root["id"].as<int>( ) == 12345 );
+	daw_ensure( as<std::string>( root["name"] ) == R"(some "quoted" name)" );
+	daw_ensure( root["nested"]["a"][2]["b"].as<double>( ) == -1500.0 );
+	daw_ensure( root["flags"].as<std::vector<std::optional<bool>>>( ).size( ) ==
+	            3 );
+	daw_ensure( root.size( ) == 8 and root["empty_array"].size( ) == 0 );
+	daw_ensure( root["empty_class"].begin( ) == root["empty_class"].end( ) );
+	daw_ensure( not root["id"]["x"] and not root["flags"]["x"] );
+
+	// Converts to a json_value
+	json_value const nested = root["nested"];
+	daw_ensure( nested.find_member( "a[1][1]" ).as<int>( ) == 3 );
+
+	// Classes large enough to have a member index
+	std::string large = "{";
+	for( int n = 0; n < 1000; ++n ) {
+		large += R"("member)" + std::to_string( n ) +
+		         R"(": { "value": )" + std::to_string( n ) + " },";
+	}
+	large += R"("member7": 0 })";
+	auto large_tape = json_tape( );
+	for( int repeat = 0; repeat < 2; ++repeat ) {
+		large_tape.parse( large );
+		auto const large_root = large_tape.root( );
+		daw_ensure( large_root.size( ) == 1001 );
+		for( int n = 999; n >= 0; --n ) {
+			auto const member = "member" + std::to_string( n );
+			daw_ensure( large_root[std::string_view( member )]["value"].as<int>( ) ==
+			            n );
+		}
+		daw_ensure( not large_root["member1000"] );
+		daw_ensure( large_root[1000].as<int>( ) == 0 );
+	}
+
+	// Documents with a single value at the root
+	daw_ensure( json_tape( " 42 " ).root( ).as<int>( ) == 42 );
+	daw_ensure( json_tape( R"("str")" ).root( ).get_string_view( ) == "str" );
+	daw_ensure( not json_tape( ).root( ) );
+
+#if defined( DAW_USE_EXCEPTIONS )
+	for( auto bad : { "[1, 2", R"({"a" 1})", "[1 2]", "{]", "", "tru" } ) {
+		bool has_thrown = false;
+		try {
+			(void)json_tape( bad );
+		} catch( json_exception const & ) { has_thrown = true; }
+		daw_ensure( has_thrown );
+	}
+#endif
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
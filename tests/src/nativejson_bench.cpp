@@ -309,6 +309,15 @@ int main( int argc, char **argv )
 		test<options::ExecModeTypes::runtime>( argv, do_asserts );
 	}
 	test<options::ExecModeTypes::simd>( argv, do_asserts );
+#if defined( DAW_ALLOW_AVX2 )
+	test<options::ExecModeTypes::avx2>( argv, do_asserts );
+#endif
+#if defined( DAW_ALLOW_AVX512 )
+	test<options::ExecModeTypes::avx512>( argv, do_asserts );
+#endif
+#if defined( DAW_JSON_CPU_DISPATCH )
+	test<options::ExecModeTypes::cpu_dispatch>( argv, do_asserts );
+#endif
 }
 #ifdef DAW_USE_EXCEPTIONS
 catch( daw::json::json_exception const &jex ) {
@@ -0,0 +1,160 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+/// @brief Arrays of numbers parsed into a std::vector take a bulk path that
+/// classifies 8 characters at a time.  Check it against values generated here
+/// with numbers of every length, whitespace, and arrays of members that are
+/// parsed out of order
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <daw/daw_ensure.h>
+
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+struct number_arrays {
+	std::vector<std::uint32_t> small;
+	std::vector<std::int64_t> signed_values;
+	std::vector<double> reals;
+
+	bool operator==( number_arrays const &rhs ) const {
+		return std::tie( small, signed_values, reals ) ==
+		       std::tie( rhs.small, rhs.signed_values, rhs.reals );
+	}
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<number_arrays> {
+		static constexpr char const small[] = "small";
+		static constexpr char const signed_values[] = "signed_values";
+		static constexpr char const reals[] = "reals";
+		using type = json_member_list<
+		  json_array<small, json_checked_number_no_name<std::uint32_t>>,
+		  json_array<signed_values, std::int64_t>, json_array<reals, double>>;
+	};
+} // namespace daw::json
+
+template<typename T>
+std::string to_json_text( std::vector<T> const &values,
+                          std::string_view separator ) {
+	std::string result = "[";
+	for( std::size_t n = 0; n < values.size( ); ++n ) {
+		if( n > 0 ) {
+			result += separator;
+		}
+		result += std::to_string( values[n] );
+	}
+	result += "]";
+	return result;
+}
+
+template<typename T>
+std::vector<T> make_values( std::mt19937_64 &rng, std::size_t count ) {
+	auto result = std::vector<T>( );
+	// Every digit count from 1 up to the full width of T
+	auto const max_digits =
+	  static_cast<std::size_t>( std::numeric_limits<T>::digits10 + 1 );
+	for( std::size_t n = 0; n < count; ++n ) {
+		auto const digits = n % max_digits;
+		T value = static_cast<T>( rng( ) % 10U );
+		for( std::size_t d = 0; d < digits; ++d ) {
+			auto const next = static_cast<T>( value * 10 + rng( ) % 10U );
+			if( next / 10 != value ) {
+				break;
+			}
+			value = next;
+		}
+		if constexpr( std::is_signed_v<T> ) {
+			if( rng( ) % 2 == 0 ) {
+				value = static_cast<T>( -value );
+			}
+		}
+		result.push_back( value );
+	}
+	result.push_back( ( std::numeric_limits<T>::max )( ) );
+	result.push_back( ( std::numeric_limits<T>::min )( ) );
+	return result;
+}
+
+template<typename T>
+void test_values( std::vector<T> const &expected ) {
+	for( auto sep : { ",", ", ", " ,\n\t" } ) {
+		auto const json_doc = to_json_text( expected, sep );
+		auto const result = daw::json::from_json_array<T>( json_doc );
+		daw_ensure( result == expected );
+		// No room after the last number to read 16 characters at once
+		auto const single = "[" + std::to_string( expected.back( ) ) + "]";
+		daw_ensure( daw::json::from_json_array<T>( single ) ==
+		            std::vector<T>{ expected.back( ) } );
+	}
+}
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	using namespace daw::json;
+	auto rng = std::mt19937_64( 42 );
+	test_values( make_values<std::uint64_t>( rng, 1000 ) );
+	test_values( make_values<std::int64_t>( rng, 1000 ) );
+	test_values( make_values<std::uint32_t>( rng, 1000 ) );
+	test_values( make_values<std::int16_t>( rng, 1000 ) );
+
+	daw_ensure( from_json_array<int>( "[]" ).empty( ) );
+	daw_ensure( from_json_array<int>( "[ \n ]" ).empty( ) );
+	daw_ensure( from_json_array<double>( "[ ]" ).empty( ) );
+
+	auto const reals = from_json_array<double>(
+	  "[0, 1.5, -2.25e2, 12345678901234567890, 3.14159265358979, 1e-5]" );
+	daw_ensure( reals.size( ) == 6 );
+	daw_ensure( reals[1] == 1.5 );
+	daw_ensure( reals[2] == -225.0 );
+	daw_ensure( reals[3] == 12345678901234567890.0 );
+	daw_ensure( reals[4] == 3.14159265358979 );
+	daw_ensure( reals[5] == 1e-5 );
+
+	// The members are out of order so the arrays are skipped first and then
+	// parsed with known bounds
+	constexpr std::string_view json_doc = R"json({
+		"reals": [ 1.0, 2.5, -3e3 ],
+		"signed_values": [ -1, 12345678901234, -9223372036854775808 ],
+		"small": [ 4294967295, 0, 17 ]
+	})json";
+	auto const expected = number_arrays{
+	  { 4294967295U, 0, 17 },
+	  { -1, 12345678901234, ( std::numeric_limits<std::int64_t>::min )( ) },
+	  { 1.0, 2.5, -3e3 } };
+	daw_ensure( from_json<number_arrays>( json_doc ) == expected );
+
+#if defined( DAW_USE_EXCEPTIONS )
+	bool has_error = false;
+	try {
+		(void)from_json<number_arrays>(
+		  R"({"small":[4294967296],"signed_values":[],"reals":[]})" );
+	} catch( json_exception const & ) { has_error = true; }
+	daw_ensure( has_error );
+#endif
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
@@ -0,0 +1,103 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <daw/daw_ensure.h>
+
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+struct price {
+	double amount;
+	float rate;
+	double whole;
+	double quoted;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<price> {
+		static constexpr char const amount[] = "amount";
+		static constexpr char const rate[] = "rate";
+		static constexpr char const whole[] = "whole";
+		static constexpr char const quoted[] = "quoted";
+		using type = json_member_list<
+		  json_number<amount, double,
+		              options::number_opt( options::fixed_decimals<2> )>,
+		  json_number<rate, float,
+		              options::number_opt( options::fixed_decimals<4> )>,
+		  json_number<whole, double,
+		              options::number_opt( options::fixed_decimals<0> )>,
+		  json_number<quoted, double,
+		              options::number_opt( options::fixed_decimals<3>,
+		                                   options::LiteralAsStringOpt::Always )>>;
+
+		static constexpr auto to_json_data( price const &p ) {
+			return std::forward_as_tuple( p.amount, p.rate, p.whole, p.quoted );
+		}
+	};
+} // namespace daw::json
+
+template<typename Integer>
+void test_integers( ) {
+	using limits = std::numeric_limits<Integer>;
+	auto values = std::vector<Integer>{ limits::min( ), limits::max( ), 0, 1 };
+	// Every power of ten and its neighbours, where the digit count changes
+	for( Integer p = 1; p <= limits::max( ) / 10; p *= 10 ) {
+		for( Integer v : { p, static_cast<Integer>( p - 1 ),
+		                   static_cast<Integer>( p * 10 - 1 ) } ) {
+			values.push_back( v );
+			if constexpr( limits::is_signed ) {
+				values.push_back( static_cast<Integer>( -v ) );
+			}
+		}
+	}
+	for( Integer v : values ) {
+		auto const expected = std::to_string( v );
+		daw_ensure( daw::json::to_json( v ) == expected );
+		daw_ensure( daw::json::from_json<Integer>( expected ) == v );
+	}
+}
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	test_integers<short>( );
+	test_integers<unsigned short>( );
+	test_integers<int>( );
+	test_integers<unsigned>( );
+	test_integers<long long>( );
+	test_integers<unsigned long long>( );
+
+	using namespace daw::json;
+	daw_ensure( to_json( price{ 1.5, 0.125f, 2.5, -0.0004 } ) ==
+	            R"({"amount":1.50,"rate":0.1250,"whole":3,"quoted":"0.000"})" );
+	daw_ensure( to_json( price{ -12345.678, -1.0f, 0.0, 1234.5678 } ) ==
+	            R"({"amount":-12345.68,"rate":-1.0000,"whole":0,)"
+	            R"("quoted":"1234.568"})" );
+	// The fixed output parses back like any number
+	auto const p = from_json<price>(
+	  to_json( price{ 1019.99, 42.0f, 7.0, 3.25 } ) );
+	daw_ensure( p.amount == 1019.99 );
+	daw_ensure( p.rate == 42.0f );
+	daw_ensure( p.quoted == 3.25 );
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
@@ -0,0 +1,176 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_parallel_array.h>
+
+#include <daw/daw_ensure.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+struct record {
+	std::int64_t id;
+	std::string name;
+	std::vector<double> values;
+
+	bool operator==( record const &rhs ) const {
+		return std::tie( id, name, values ) ==
+		       std::tie( rhs.id, rhs.name, rhs.values );
+	}
+};
+
+// Not default constructible, so the elements go through std::optional slots
+struct point {
+	int x;
+	int y;
+
+	point( int px, int py )
+	  : x( px )
+	  , y( py ) {}
+
+	bool operator==( point const &rhs ) const {
+		return x == rhs.x and y == rhs.y;
+	}
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<record> {
+		static constexpr char const id[] = "id";
+		static constexpr char const name[] = "name";
+		static constexpr char const values[] = "values";
+		using type =
+		  json_member_list<json_number<id, std::int64_t>, json_string<name>,
+		                   json_array<values, double>>;
+	};
+
+	template<>
+	struct json_data_contract<point> {
+		static constexpr char const x[] = "x";
+		static constexpr char const y[] = "y";
+		using type = json_member_list<json_number<x, int>, json_number<y, int>>;
+	};
+} // namespace daw::json
+
+std::string make_records( std::size_t count ) {
+	std::string result = "[ ";
+	for( std::size_t n = 0; n < count; ++n ) {
+		if( n > 0 ) {
+			result += ",\n";
+		}
+		result += R"({"id":)" + std::to_string( n ) + R"(,"name":"r\")" +
+		          std::to_string( n ) + R"(","values":[)";
+		for( std::size_t m = 0; m < n % 13; ++m ) {
+			if( m > 0 ) {
+				result += ',';
+			}
+			result += std::to_string( m ) + ".5";
+		}
+		result += "]}";
+	}
+	result += " ]";
+	return result;
+}
+
+template<typename JsonElement, typename... Flags>
+void test_same_as_serial( std::string const &doc, Flags... flags ) {
+	using namespace daw::json;
+	auto const expected = from_json_array<JsonElement>( doc, flags... );
+	for( std::size_t thread_count : { 1U, 2U, 5U } ) {
+		for( std::size_t per_task : { 0U, 1U, 7U, 100000U } ) {
+			auto const result = from_json_array_parallel<JsonElement>(
+			  doc, parallel_json_array_options{ thread_count, per_task },
+			  flags... );
+			daw_ensure( result == expected );
+		}
+	}
+}
+
+#if defined( DAW_USE_EXCEPTIONS )
+template<typename JsonElement>
+void test_same_error( std::string const &doc ) {
+	using namespace daw::json;
+	ErrorReason expected_reason = ErrorReason::Unknown;
+	char const *expected_location = nullptr;
+	try {
+		(void)from_json_array<JsonElement>( doc );
+		daw_ensure( false );
+	} catch( json_exception const &jex ) {
+		expected_reason = jex.reason_type( );
+		expected_location = jex.parse_location( );
+	}
+	for( std::size_t thread_count : { 1U, 4U } ) {
+		bool has_thrown = false;
+		try {
+			(void)from_json_array_parallel<JsonElement>(
+			  doc, parallel_json_array_options{ thread_count, 3 } );
+		} catch( json_exception const &jex ) {
+			has_thrown = true;
+			daw_ensure( jex.reason_type( ) == expected_reason );
+			daw_ensure( jex.parse_location( ) == expected_location );
+		}
+		daw_ensure( has_thrown );
+	}
+}
+#endif
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	using namespace daw::json;
+	auto const records = make_records( 3000 );
+	test_same_as_serial<record>( records );
+	test_same_as_serial<record>(
+	  records, options::parse_flags<options::UseStructuralIndex::yes> );
+	test_same_as_serial<record>(
+	  records, options::parse_flags<options::CheckedParseMode::no> );
+	test_same_as_serial<record>( std::string( "[]" ) );
+	test_same_as_serial<record>( make_records( 1 ) );
+
+	test_same_as_serial<point>(
+	  R"([{"x":1,"y":2},{"y":4,"x":3},{"x":5,"y":6}])" );
+	test_same_as_serial<int>( "[1, 2, 3, 4, 5, 6, 7, 8, 9, 10]" );
+	test_same_as_serial<bool>( "[true,false,true,true,false]" );
+	test_same_as_serial<std::string>( R"(["a","b\"c","","dA"])" );
+	test_same_as_serial<std::vector<int>>( "[[1,2],[],[3,4],[5]]" );
+
+#if defined( DAW_USE_EXCEPTIONS )
+	// The first of several invalid elements is reported, as when serial
+	auto bad_records = make_records( 2000 );
+	auto const first_bad = bad_records.find( R"("id":1500,)" );
+	bad_records.replace( first_bad, 10, R"("id":"x",)" );
+	auto const second_bad = bad_records.find( R"("id":20,)" );
+	bad_records.replace( second_bad, 8, R"("id":[],)" );
+	test_same_error<record>( bad_records );
+	// Truncated in the middle of an element
+	test_same_error<record>( make_records( 50 ).substr( 0, 2000 ) );
+	// An invalid element before a structural error still comes first
+	auto bad_tail = make_records( 100 );
+	bad_tail.replace( bad_tail.find( R"("id":7,)" ), 7, R"("id":-,)" );
+	test_same_error<record>( bad_tail.substr( 0, bad_tail.size( ) - 20 ) );
+	test_same_error<int>( "[1, 2, 3 4]" );
+	test_same_error<int>( "[1, 2, 3" );
+	test_same_error<int>( "{}" );
+#endif
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
@@ -0,0 +1,171 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_parallel_lines.h>
+
+#include <daw/daw_ensure.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct line_entry {
+	std::int64_t id;
+	std::string name;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<line_entry> {
+		static constexpr char const id[] = "id";
+		static constexpr char const name[] = "name";
+		using type = json_member_list<json_number<id, std::int64_t>,
+		                              json_string<name>>;
+	};
+} // namespace daw::json
+
+// Lines of very different lengths, with blank lines and escaped newlines in
+// the strings, so that chunks rarely end on a line boundary
+std::string make_jsonl_doc( std::size_t line_count ) {
+	std::string result;
+	for( std::size_t n = 0; n < line_count; ++n ) {
+		result += R"({"id":)" + std::to_string( n ) + R"(,"name":")";
+		result.append( ( n * 7919U ) % 300U, 'x' );
+		if( n % 5 == 0 ) {
+			result += R"(\n\"})";
+		}
+		result += "\"}\n";
+		if( n % 17 == 0 ) {
+			result += "\n";
+		}
+	}
+	return result;
+}
+
+template<daw::json::options::ExecModeTypes ExecMode>
+void test_parallel_lines( std::string const &doc, std::size_t line_count,
+                          std::size_t thread_count, std::size_t chunk_size ) {
+	using namespace daw::json;
+	auto const lines = parallel_json_lines<line_entry, ExecMode>(
+	  doc, parallel_json_lines_options{ thread_count, chunk_size } );
+	daw_ensure( lines.thread_count( ) <= thread_count );
+
+	// Every line is in exactly one chunk
+	std::size_t chunk_lines = 0;
+	for( std::size_t n = 0; n < lines.chunk_count( ); ++n ) {
+		auto const range = lines.chunk( n );
+		chunk_lines += static_cast<std::size_t>(
+		  std::distance( range.begin( ), range.end( ) ) );
+	}
+	daw_ensure( chunk_lines == line_count );
+
+	auto const ids = lines.collect( []( line_entry const &e ) {
+		return e.id;
+	} );
+	daw_ensure( ids.size( ) == line_count );
+	for( std::size_t n = 0; n < ids.size( ); ++n ) {
+		daw_ensure( ids[n] == static_cast<std::int64_t>( n ) );
+	}
+
+	auto const entries = lines.collect( );
+	daw_ensure( entries.size( ) == line_count );
+	if( not entries.empty( ) ) {
+		daw_ensure( entries.back( ).id ==
+		            static_cast<std::int64_t>( line_count - 1 ) );
+	}
+
+	// Not commutative, so this only holds when the chunks are folded in order
+	auto const order = lines.reduce(
+	  std::string( ),
+	  []( line_entry const &e ) {
+		  return std::to_string( e.id ) + ',';
+	  },
+	  []( std::string lhs, std::string const &rhs ) {
+		  return lhs += rhs;
+	  } );
+	std::string expected_order;
+	for( std::size_t n = 0; n < line_count; ++n ) {
+		expected_order += std::to_string( n ) + ',';
+	}
+	daw_ensure( order == expected_order );
+
+	auto const states = lines.for_each_with_state(
+	  [] {
+		  return std::size_t{ 0 };
+	  },
+	  []( std::size_t &count, line_entry const & ) {
+		  ++count;
+	  } );
+	daw_ensure( states.size( ) == lines.thread_count( ) );
+	daw_ensure( std::accumulate( states.begin( ), states.end( ),
+	                             std::size_t{ 0 } ) == line_count );
+}
+
+#if defined( DAW_USE_EXCEPTIONS )
+void test_error_is_rethrown( ) {
+	using namespace daw::json;
+	auto doc = make_jsonl_doc( 2000 );
+	doc += "{\"id\":\"not a number\",\"name\":\"\"}\n";
+	doc += make_jsonl_doc( 2000 );
+	auto const lines = parallel_json_lines<line_entry>(
+	  doc, parallel_json_lines_options{ 4, 1024 } );
+	bool has_thrown = false;
+	try {
+		lines.for_each( []( line_entry const & ) {} );
+	} catch( json_exception const & ) { has_thrown = true; }
+	daw_ensure( has_thrown );
+}
+#endif
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	using namespace daw::json;
+	constexpr std::size_t line_count = 5000;
+	auto const doc = make_jsonl_doc( line_count );
+
+	for( std::size_t thread_count : { 1U, 2U, 3U, 8U } ) {
+		for( std::size_t chunk_size : { 1U, 100U, 4096U, 1U << 20U } ) {
+			test_parallel_lines<options::ExecModeTypes::compile_time>(
+			  doc, line_count, thread_count, chunk_size );
+			test_parallel_lines<options::ExecModeTypes::runtime>(
+			  doc, line_count, thread_count, chunk_size );
+			test_parallel_lines<options::ExecModeTypes::cpu_dispatch>(
+			  doc, line_count, thread_count, chunk_size );
+		}
+	}
+	// No trailing newline, and a document of only whitespace
+	auto doc_no_newline = doc;
+	while( doc_no_newline.back( ) == '\n' ) {
+		doc_no_newline.pop_back( );
+	}
+	test_parallel_lines<options::ExecModeTypes::runtime>(
+	  doc_no_newline, line_count, 4, 512 );
+	test_parallel_lines<options::ExecModeTypes::runtime>( "\n \n\n", 0, 4, 1 );
+	test_parallel_lines<options::ExecModeTypes::runtime>( "", 0, 4, 1 );
+
+#if defined( DAW_USE_EXCEPTIONS )
+	test_error_is_rethrown( );
+#endif
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
@@ -0,0 +1,112 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_parallel_array.h>
+
+#include <daw/daw_ensure.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+struct record {
+	std::int64_t id;
+	std::string name;
+	std::vector<double> values;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<record> {
+		static constexpr char const id[] = "id";
+		static constexpr char const name[] = "name";
+		static constexpr char const values[] = "values";
+		using type =
+		  json_member_list<json_number<id, std::int64_t>, json_string<name>,
+		                   json_array<values, double>>;
+
+		static constexpr auto to_json_data( record const &r ) {
+			return std::forward_as_tuple( r.id, r.name, r.values );
+		}
+	};
+} // namespace daw::json
+
+template<typename JsonElement = daw::json::use_default, typename Container,
+         typename... Flags>
+void test_same_as_serial( Container const &c, Flags... flags ) {
+	using namespace daw::json;
+	auto const expected = to_json_array<JsonElement>( c, flags... );
+	for( std::size_t thread_count : { 1U, 2U, 5U } ) {
+		for( std::size_t per_task : { 0U, 1U, 7U, 100000U } ) {
+			auto const result = to_json_array_parallel<JsonElement>(
+			  c, parallel_json_array_options{ thread_count, per_task }, flags... );
+			daw_ensure( result == expected );
+		}
+	}
+}
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	using namespace daw::json;
+	auto records = std::vector<record>( );
+	for( std::int64_t n = 0; n < 3000; ++n ) {
+		auto r = record{ n, "r\"" + std::to_string( n ), { } };
+		for( std::int64_t m = 0; m < n % 13; ++m ) {
+			r.values.push_back( static_cast<double>( m ) + 0.5 );
+		}
+		records.push_back( std::move( r ) );
+	}
+	test_same_as_serial( records );
+	test_same_as_serial(
+	  records, options::output_flags<options::SerializationFormat::Pretty> );
+	test_same_as_serial(
+	  records, options::output_flags<options::SerializationFormat::Pretty,
+	                                 options::IndentationType::Space2> );
+	test_same_as_serial( std::vector<record>( ) );
+	test_same_as_serial(
+	  std::vector<record>( ),
+	  options::output_flags<options::SerializationFormat::Pretty> );
+	test_same_as_serial( std::vector<record>( records.begin( ),
+	                                          records.begin( ) + 1 ) );
+	test_same_as_serial( std::vector<int>{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 } );
+	test_same_as_serial( std::vector<std::string>{ "a", "b\"c", "", "d\n" } );
+	test_same_as_serial( std::vector<std::vector<int>>{ { 1, 2 }, { }, { 3 } } );
+
+#if defined( DAW_USE_EXCEPTIONS )
+	// NaN cannot be serialized, the first of the invalid elements is reported
+	auto values = std::vector<double>( 1000, 1.5 );
+	values[700] = std::numeric_limits<double>::quiet_NaN( );
+	values[20] = std::numeric_limits<double>::infinity( );
+	for( std::size_t thread_count : { 1U, 4U } ) {
+		bool has_thrown = false;
+		try {
+			(void)to_json_array_parallel(
+			  values, parallel_json_array_options{ thread_count, 3 } );
+		} catch( json_exception const &jex ) {
+			has_thrown = true;
+			daw_ensure( jex.reason_type( ) == ErrorReason::NumberIsInf );
+		}
+		daw_ensure( has_thrown );
+	}
+#endif
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
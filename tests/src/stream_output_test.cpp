@@ -10,10 +10,13 @@
 
 #include "daw/json/daw_json_link.h"
 
+#include <cstddef>
 #include <cstdio>
 #include <cstdlib>
 #include <iostream>
+#include <sstream>
 #include <string>
+#include <vector>
 
 namespace daw::cookbook_class1 {
 	struct MyClass1 {
@@ -51,6 +54,95 @@ namespace daw::json {
 	};
 } // namespace daw::json
 
+// Serialize to a temporary file with the output made by make_output, and
+// read back what was written
+template<typename MakeOutput>
+std::string write_to_file( std::vector<daw::cookbook_class1::MyClass1> const &v,
+                           MakeOutput make_output ) {
+	std::FILE *f = std::tmpfile( );
+	test_assert( f != nullptr, "Could not open temporary file" );
+	make_output( f, v );
+	std::rewind( f );
+	std::string result{ };
+	char buff[4096];
+	std::size_t count = 0;
+	while( ( count = std::fread( buff, 1, sizeof( buff ), f ) ) > 0 ) {
+		result.append( buff, count );
+	}
+	std::fclose( f );
+	return result;
+}
+
+// The buffered outputs must write the same bytes as the direct ones
+void test_buffered_outputs( ) {
+	using daw::cookbook_class1::MyClass1;
+	auto v = std::vector<MyClass1>( );
+	for( int n = 0; n < 5000; ++n ) {
+		v.push_back( MyClass1{ "member \"" + std::to_string( n ) + "\"",
+		                       n * 31, n % 3 == 0 } );
+	}
+	auto const expected = daw::json::to_json_array( v );
+
+	auto const direct_file =
+	  write_to_file( v, []( std::FILE *f, auto const &values ) {
+		  (void)daw::json::to_json_array( values, f );
+	  } );
+	test_assert( direct_file == expected, "Unexpected FILE * output" );
+
+	auto const buffered_file =
+	  write_to_file( v, []( std::FILE *f, auto const &values ) {
+		  auto out = daw::json::buffered_file_output( f );
+		  (void)daw::json::to_json_array( values, out );
+		  out.flush( );
+	  } );
+	test_assert( buffered_file == expected, "Unexpected buffered output" );
+
+	auto const unlocked_file =
+	  write_to_file( v, []( std::FILE *f, auto const &values ) {
+		  auto out = daw::json::unlocked_buffered_file_output( f );
+		  (void)daw::json::to_json_array( values, out );
+		  out.flush( );
+	  } );
+	test_assert( unlocked_file == expected, "Unexpected unlocked output" );
+
+	// A buffer smaller than some strings, flushed by the destructor
+	auto const small_buffer =
+	  write_to_file( v, []( std::FILE *f, auto const &values ) {
+		  auto out = daw::json::basic_buffered_output<
+		    daw::json::basic_file_sink<false>, 8>( f );
+		  (void)daw::json::to_json_array( values, out );
+	  } );
+	test_assert( small_buffer == expected, "Unexpected small buffer output" );
+
+	std::ostringstream direct_os{ };
+	(void)daw::json::to_json_array( v, direct_os );
+	test_assert( direct_os.str( ) == expected, "Unexpected ostream output" );
+
+	std::ostringstream buffered_os{ };
+	{
+		auto out = daw::json::buffered_ostream_output( buffered_os );
+		(void)daw::json::to_json_array( v, out );
+	}
+	test_assert( buffered_os.str( ) == expected,
+	             "Unexpected buffered ostream output" );
+
+#if defined( DAW_USE_EXCEPTIONS )
+	// The flush in the destructor must not let an ostream that throws on
+	// failure escape and terminate.  The document fits in the buffer, so the
+	// destructor makes the only write
+	struct failing_buf : std::streambuf {};
+	auto fail_buf = failing_buf{ };
+	std::ostream failing_os( &fail_buf );
+	failing_os.exceptions( std::ios::badbit );
+	{
+		auto out = daw::json::buffered_ostream_output( failing_os );
+		(void)daw::json::to_json_array(
+		  std::vector<MyClass1>( v.begin( ), v.begin( ) + 2 ), out );
+	}
+	test_assert( failing_os.bad( ), "Expected the write to fail" );
+#endif
+}
+
 int main( int, char ** )
 #ifdef DAW_USE_EXCEPTIONS
   try
@@ -77,6 +169,8 @@ int main( int, char ** )
 	(void)daw::json::to_json( cls, it );
 	std::string const str = ss.str( );
 	puts( str.c_str( ) );
+
+	test_buffered_outputs( );
 }
 #ifdef DAW_USE_EXCEPTIONS
 catch( daw::json::json_exception const &jex ) {
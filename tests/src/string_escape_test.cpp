@@ -0,0 +1,172 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <daw/daw_ensure.h>
+
+#include <cstddef>
+#include <deque>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+// Escape a string a byte at a time
+std::string expected_json( std::string_view s ) {
+	constexpr char const hex[] = "0123456789ABCDEF";
+	std::string result = "\"";
+	for( char c : s ) {
+		switch( c ) {
+		case '"':
+			result += "\\\"";
+			break;
+		case '\\':
+			result += "\\\\";
+			break;
+		case '\b':
+			result += "\\b";
+			break;
+		case '\f':
+			result += "\\f";
+			break;
+		case '\n':
+			result += "\\n";
+			break;
+		case '\r':
+			result += "\\r";
+			break;
+		case '\t':
+			result += "\\t";
+			break;
+		default:
+			if( static_cast<unsigned char>( c ) < 0x20U ) {
+				result += "\\u00";
+				result += hex[static_cast<unsigned char>( c ) >> 4U];
+				result += hex[static_cast<unsigned char>( c ) & 0xFU];
+			} else {
+				result += c;
+			}
+		}
+	}
+	result += '"';
+	return result;
+}
+
+// A std::string is escaped by copying runs of clean bytes, while other
+// containers, like std::deque<char>, still decode every codepoint
+template<auto... PolicyFlags, typename Container>
+std::string copy_escaped( Container const &s ) {
+	using namespace daw::json;
+	auto result = std::string( );
+	auto it =
+	  serialization_policy<std::string,
+	                       options::output_flags_t<PolicyFlags...>::value>(
+	    result );
+	(void)utils::copy_to_iterator<true>( it, s );
+	return result;
+}
+
+template<auto... PolicyFlags>
+void test_same_as_per_codepoint( std::string const &s ) {
+	auto const per_codepoint =
+	  copy_escaped<PolicyFlags...>( std::deque<char>( s.begin( ), s.end( ) ) );
+	daw_ensure( copy_escaped<PolicyFlags...>( s ) == per_codepoint );
+}
+
+#if defined( DAW_USE_EXCEPTIONS )
+bool throws_invalid_codepoint( std::string const &s ) {
+	using namespace daw::json;
+	try {
+		(void)copy_escaped<options::RestrictedStringOutput::OnlyAllow7bitsStrings>(
+		  s );
+	} catch( daw::json::json_exception const &jex ) {
+		return jex.reason_type( ) == daw::json::ErrorReason::InvalidUTFCodepoint;
+	}
+	return false;
+}
+#endif
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	using namespace daw::json;
+	constexpr std::string_view specials[] = {
+	  "\"", "\\", "\n", "\t", "\x01", "\x1F", "\x7F", "é", "€", "😍" };
+	// Put each special at every offset of a string longer than the widest
+	// SIMD block, so that it is found in each lane and in the tail
+	for( std::string_view special : specials ) {
+		for( std::size_t length = 0; length < 150; ++length ) {
+			for( std::size_t pos = 0; pos <= length; pos += 7 ) {
+				auto s = std::string( length, 'a' );
+				s.insert( pos, special );
+				auto const json = to_json( s );
+				daw_ensure( json == expected_json( s ) );
+				daw_ensure( from_json<std::string>( json ) == s );
+
+				auto const ascii_json = to_json(
+				  s, options::output_flags<
+				       options::RestrictedStringOutput::OnlyAllow7bitsStrings> );
+				for( char c : ascii_json ) {
+					daw_ensure( static_cast<unsigned char>( c ) < 0x80U );
+				}
+				daw_ensure( from_json<std::string>( ascii_json ) == s );
+			}
+		}
+	}
+
+	// Bytes of 0x80 and up are copied as they are, valid UTF-8 or not.  When
+	// only 7 bit output is allowed, invalid UTF-8 is decoded the same way as
+	// before.  Lone continuation bytes and lead bytes of 0xF8 and up are a
+	// single byte codepoint, and a truncated sequence followed by more bytes
+	// takes the bytes after it
+	constexpr std::string_view invalid[] = {
+	  "\x80", "\xBF", "\xF8", "\xFC",
+	  "\xFF", "\xC3", "\xE2\x82", "\xF0\x9F\x98" };
+	for( std::string_view bad : invalid ) {
+		for( std::size_t length = 4; length < 150; ++length ) {
+			for( std::size_t pos = 0; pos + 3 <= length; pos += 7 ) {
+				auto s = std::string( length, 'a' );
+				s.insert( pos, bad );
+				daw_ensure( to_json( s ) == expected_json( s ) );
+				test_same_as_per_codepoint<
+				  options::RestrictedStringOutput::OnlyAllow7bitsStrings>( s );
+			}
+		}
+	}
+	// At the end, the 1 byte codepoints are the same as before.  A truncated
+	// sequence used to be decoded past the end, with 7 bit output it is now an
+	// error
+	for( std::string_view bad : { "\x80", "\xBF", "\xF8", "\xFF", "\xC3" } ) {
+		auto const s = "abc" + std::string( bad );
+		daw_ensure( to_json( s ) == expected_json( s ) );
+	}
+	for( std::string_view bad : { "\x80", "\xBF", "\xF8", "\xFF" } ) {
+		auto const s = "abc" + std::string( bad );
+		test_same_as_per_codepoint<
+		  options::RestrictedStringOutput::OnlyAllow7bitsStrings>( s );
+	}
+#if defined( DAW_USE_EXCEPTIONS )
+	for( std::string_view bad :
+	     { "\xC3", "\xE2\x82", "\xF0\x9F\x98", "\xF4\x8F" } ) {
+		for( std::size_t length = 0; length < 150; ++length ) {
+			auto const s = std::string( length, 'a' ) + std::string( bad );
+			daw_ensure( throws_invalid_codepoint( s ) );
+		}
+	}
+#endif
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
@@ -0,0 +1,192 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <daw/daw_ensure.h>
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+struct Inner {
+	int a;
+	std::string b;
+
+	bool operator==( Inner const &rhs ) const {
+		return std::tie( a, b ) == std::tie( rhs.a, rhs.b );
+	}
+};
+
+struct Outer {
+	std::vector<Inner> items;
+	int last;
+	Inner first;
+
+	bool operator==( Outer const &rhs ) const {
+		return std::tie( items, last, first ) ==
+		       std::tie( rhs.items, rhs.last, rhs.first );
+	}
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Inner> {
+		static constexpr char const a[] = "a";
+		static constexpr char const b[] = "b";
+		using type = json_member_list<json_number<a, int>, json_string<b>>;
+	};
+
+	template<>
+	struct json_data_contract<Outer> {
+		static constexpr char const items[] = "items";
+		static constexpr char const last[] = "last";
+		static constexpr char const first[] = "first";
+		using type =
+		  json_member_list<json_array<items, Inner>, json_number<last, int>,
+		                   json_class<first, Inner>>;
+	};
+} // namespace daw::json
+
+// Unmapped members hold brackets inside strings and escaped quotes so that the
+// index has to track string state correctly.  The mapped members are out of
+// order, so the parser has to skip past the unmapped ones more than once
+static constexpr std::string_view json_doc = R"json({
+	"skip0": { "x": [1, 2, {"y": "}]\"[{"}], "z": "\\" },
+	"last": 42,
+	"skip1": [[[], {}], [{"q": ",,,"}], "]"],
+	"first": { "unused": [ {"c": [1,2,3]} ], "b": "one\"}", "a": 1 },
+	"skip2": "{[",
+	"items": [
+		{ "a": 2, "b": "two", "extra": { "n": [ [ ], [ { } ] ] } },
+		{ "extra": [ "]", "}" ], "b": "three", "a": 3 }
+	],
+	"skip3": { "deep": { "deeper": { "deepest": [ { }, [ ], "\\\"" ] } } }
+})json";
+
+template<typename ExecTag>
+void test_index( ) {
+	using daw::json::json_details::structural_index;
+	char const *const first = std::data( json_doc );
+	auto const index =
+	  structural_index( ExecTag{ }, first, first + json_doc.size( ) );
+	daw_ensure( index.is_valid( ) );
+	// Count the brackets outside of strings by hand
+	std::size_t opens = 0;
+	bool in_string = false;
+	for( std::size_t n = 0; n < json_doc.size( ); ++n ) {
+		char const c = json_doc[n];
+		if( in_string ) {
+			if( c == '\\' ) {
+				++n;
+			} else if( c == '"' ) {
+				in_string = false;
+			}
+		} else if( c == '"' ) {
+			in_string = true;
+		} else if( c == '{' or c == '[' ) {
+			++opens;
+		}
+	}
+	daw_ensure( index.size( ) == opens );
+	auto const *root = index.find( first );
+	daw_ensure( root != nullptr );
+	daw_ensure( root->close == json_doc.size( ) );
+	// 7 members, 6 commas directly in the root
+	daw_ensure( root->count == 6 );
+	auto const items = json_doc.find( "[\n" );
+	auto const *items_entry = index.find( first + items );
+	daw_ensure( items_entry != nullptr );
+	daw_ensure( json_doc[items_entry->close - 1] == ']' );
+	daw_ensure( items_entry->count == 1 );
+	// Not a bracket
+	daw_ensure( index.find( first + 1 ) == nullptr );
+	// Not in the document
+	auto const other = std::string( json_doc );
+	daw_ensure( index.find( other.data( ) ) == nullptr );
+
+	// Walking the document with a cursor, forwards and then back, finds the
+	// same entries as searching from the start each time
+	std::size_t cursor = 0;
+	for( std::size_t n = 0; n < json_doc.size( ); ++n ) {
+		daw_ensure( index.find( first + n, cursor ) == index.find( first + n ) );
+	}
+	for( std::size_t n = json_doc.size( ); n-- > 0; ) {
+		daw_ensure( index.find( first + n, cursor ) == index.find( first + n ) );
+	}
+	// Finding an entry moves the cursor past everything inside it
+	cursor = 0;
+	daw_ensure( index.find( first, cursor ) == root );
+	daw_ensure( cursor == index.size( ) );
+	daw_ensure( index.find( first + items, cursor ) == items_entry );
+
+	auto const bad = std::string_view( R"({"a":[1,2})" );
+	auto const bad_index = structural_index( ExecTag{ }, std::data( bad ),
+	                                         std::data( bad ) + bad.size( ) );
+	daw_ensure( not bad_index.is_valid( ) );
+	daw_ensure( bad_index.empty( ) );
+}
+
+template<daw::json::options::ExecModeTypes ExecMode>
+void test_parse( Outer const &expected ) {
+	using namespace daw::json;
+	constexpr auto flags =
+	  options::parse_flags<options::UseStructuralIndex::yes, ExecMode>;
+	auto const result = from_json<Outer>( json_doc, flags );
+	daw_ensure( result == expected );
+
+	auto const items = from_json_array<Inner>(
+	  R"([{"x":[{"a":1}],"b":"x","a":1},{"a":2,"y":{"b":"]"},"b":"y"}])", flags );
+	daw_ensure( items.size( ) == 2 );
+	daw_ensure( items[0] == ( Inner{ 1, "x" } ) );
+	daw_ensure( items[1] == ( Inner{ 2, "y" } ) );
+}
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	using namespace daw::json;
+	auto const expected = from_json<Outer>( json_doc );
+	daw_ensure( expected.last == 42 );
+	daw_ensure( expected.first == ( Inner{ 1, "one\"}" } ) );
+	daw_ensure( expected.items.size( ) == 2 );
+	daw_ensure( expected.items[1] == ( Inner{ 3, "three" } ) );
+
+	test_index<constexpr_exec_tag>( );
+	test_index<runtime_exec_tag>( );
+	test_index<cpu_dispatch_exec_tag>( );
+#if defined( DAW_ALLOW_SSE42 )
+	test_index<sse42_exec_tag>( );
+#endif
+#if defined( DAW_ALLOW_AVX2 )
+	test_index<avx2_exec_tag>( );
+#endif
+#if defined( DAW_ALLOW_AVX512 )
+	test_index<avx512_exec_tag>( );
+#endif
+
+	test_parse<options::ExecModeTypes::compile_time>( expected );
+	test_parse<options::ExecModeTypes::runtime>( expected );
+	test_parse<options::ExecModeTypes::simd>( expected );
+	test_parse<options::ExecModeTypes::avx2>( expected );
+	test_parse<options::ExecModeTypes::avx512>( expected );
+	test_parse<options::ExecModeTypes::cpu_dispatch>( expected );
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
@@ -0,0 +1,211 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Compare the AVX2, AVX512BW, and cpu_dispatch kernels with the byte at a
+// time ones.  The character each kernel stops at is moved across every 32
+// and 64 byte block boundary, from every start offset in a block, with and
+// without the range ending before it.  Kernels the CPU cannot run are skipped.
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/impl/daw_not_const_ex_functions.h>
+
+#include <daw/daw_ensure.h>
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+using namespace daw::json;
+using namespace daw::json::json_details;
+
+namespace {
+	// Wide enough that a stop position crosses two 64 byte blocks from any
+	// start offset, with room for the unchecked kernels to read a block past
+	// it
+	constexpr std::size_t max_start = 64;
+	constexpr std::size_t max_pos = 160;
+	constexpr std::size_t buffer_size = max_start + max_pos + 128;
+
+	template<typename ExecTag>
+	void test_skip_whitespace( ) {
+		constexpr std::string_view kinds = " \t\n\r\x01\x1F";
+		auto buf = std::string( buffer_size, ' ' );
+		for( std::size_t n = 0; n < buf.size( ); ++n ) {
+			buf[n] = kinds[n % kinds.size( )];
+		}
+		for( char stop : { 'x', '\0', '"', '\x7F' } ) {
+			for( std::size_t start = 0; start < max_start; ++start ) {
+				for( std::size_t pos = 0; pos < max_pos; ++pos ) {
+					auto doc = buf;
+					char const *const first = doc.data( ) + start;
+					doc[start + pos] = stop;
+					for( char const *last :
+					     { first + pos + 1, first + pos, first + max_pos } ) {
+						daw_ensure(
+						  mem_skip_whitespace( ExecTag{ }, first, last ) ==
+						  mem_skip_whitespace( constexpr_exec_tag{ }, first, last ) );
+					}
+				}
+			}
+		}
+	}
+
+	// Without restrict_high, 0x7F and up are not a stop and the kernels must
+	// run past them
+	template<bool restrict_high, typename ExecTag>
+	void test_find_string_escape( ) {
+		for( char stop : { '"', '\\', '\x00', '\x1F', '\x7F', '\x80', '\xFF' } ) {
+			for( std::size_t start = 0; start < max_start; ++start ) {
+				for( std::size_t pos = 0; pos < max_pos; ++pos ) {
+					auto doc = std::string( buffer_size, 'a' );
+					char const *const first = doc.data( ) + start;
+					doc[start + pos] = stop;
+					for( char const *last :
+					     { first + pos + 1, first + pos, first + max_pos } ) {
+						daw_ensure( mem_find_string_escape<restrict_high>(
+						              ExecTag{ }, first, last ) ==
+						            mem_find_string_escape<restrict_high>(
+						              constexpr_exec_tag{ }, first, last ) );
+					}
+				}
+			}
+		}
+	}
+
+	template<typename ExecTag>
+	void test_skip_until_end_of_string( ) {
+		for( std::size_t start = 0; start < max_start; ++start ) {
+			for( std::size_t pos = 3; pos < max_pos; ++pos ) {
+				// An escaped quote and backslash before the closing quote, with the
+				// backslash of the escaped quote on either side of each boundary
+				for( std::size_t escape : { pos / 3, pos / 2, pos - 2 } ) {
+					auto doc = std::string( buffer_size, 'a' );
+					char const *const first = doc.data( ) + start;
+					doc[start + escape] = '\\';
+					doc[start + escape + 1] = escape % 2 == 0 ? '"' : '\\';
+					doc[start + pos] = '"';
+					char const *const expected =
+					  mem_skip_until_end_of_string<false>( constexpr_exec_tag{ },
+					                                       first, first + max_pos );
+					daw_ensure( *expected == '"' );
+					daw_ensure( mem_skip_until_end_of_string<false>(
+					              ExecTag{ }, first, first + max_pos ) == expected );
+					daw_ensure( mem_skip_until_end_of_string<true>(
+					              ExecTag{ }, first, first + max_pos ) == expected );
+
+					std::ptrdiff_t expected_escape = -1;
+					(void)mem_skip_until_end_of_string<false>(
+					  runtime_exec_tag{ }, first, first + max_pos, expected_escape );
+					std::ptrdiff_t first_escape = -1;
+					daw_ensure( mem_skip_until_end_of_string<false>(
+					              ExecTag{ }, first, first + max_pos,
+					              first_escape ) == expected );
+					daw_ensure( first_escape == expected_escape );
+				}
+				// Without a closing quote, the checked kernels stop at last
+				auto doc = std::string( buffer_size, 'a' );
+				char const *const first = doc.data( ) + start;
+				daw_ensure( mem_skip_until_end_of_string<false>(
+				              ExecTag{ }, first, first + pos ) ==
+				            mem_skip_until_end_of_string<false>(
+				              constexpr_exec_tag{ }, first, first + pos ) );
+			}
+		}
+	}
+
+	template<typename ExecTag>
+	void test_move_to_next_of( ) {
+		// runtime_exec_tag is the byte at a time loop for more than one key
+		for( char stop : { '"', ',', '[', ']', '{', '}', '\\' } ) {
+			for( std::size_t start = 0; start < max_start; ++start ) {
+				for( std::size_t pos = 0; pos < max_pos; ++pos ) {
+					auto doc = std::string( buffer_size, 'a' );
+					char const *const first = doc.data( ) + start;
+					doc[start + pos] = stop;
+					for( char const *last :
+					     { first + pos + 1, first + pos, first + max_pos } ) {
+						daw_ensure(
+						  mem_move_to_next_of<false, '"', ',', '[', ']', '{', '}', '\\'>(
+						    ExecTag{ }, first, last ) ==
+						  mem_move_to_next_of<false, '"', ',', '[', ']', '{', '}', '\\'>(
+						    runtime_exec_tag{ }, first, last ) );
+					}
+					daw_ensure(
+					  mem_move_to_next_of<true, '"', ',', '[', ']', '{', '}', '\\'>(
+					    ExecTag{ }, first, first + max_pos ) == first + pos );
+				}
+			}
+		}
+	}
+
+	template<typename ExecTag>
+	void test_kernels( std::string_view name, bool cpu_supported ) {
+		if( not cpu_supported ) {
+			std::cout << "Skipping " << name
+			          << " kernels, the CPU does not support them\n";
+			return;
+		}
+		test_skip_whitespace<ExecTag>( );
+		test_find_string_escape<true, ExecTag>( );
+		test_find_string_escape<false, ExecTag>( );
+		test_skip_until_end_of_string<ExecTag>( );
+		test_move_to_next_of<ExecTag>( );
+		std::cout << name << " kernels match constexpr\n";
+	}
+
+#if defined( DAW_JSON_CPU_DISPATCH )
+	bool cpu_supports( cpu_dispatch::simd_level level ) {
+		return cpu_dispatch::current_simd_level( ) >= level;
+	}
+#endif
+
+	[[maybe_unused]] bool cpu_supports_avx2( ) {
+#if defined( DAW_JSON_CPU_DISPATCH )
+		return cpu_supports( cpu_dispatch::simd_level::avx2 );
+#elif defined( __GNUC__ ) or defined( __clang__ )
+		return __builtin_cpu_supports( "avx2" );
+#else
+		return true;
+#endif
+	}
+
+	[[maybe_unused]] bool cpu_supports_avx512( ) {
+#if defined( DAW_JSON_CPU_DISPATCH )
+		return cpu_supports( cpu_dispatch::simd_level::avx512 );
+#elif defined( __GNUC__ ) or defined( __clang__ )
+		return __builtin_cpu_supports( "avx512bw" );
+#else
+		return true;
+#endif
+	}
+} // namespace
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+#if defined( DAW_JSON_HAS_AVX2_KERNELS )
+	test_kernels<avx2_exec_tag>( "avx2", cpu_supports_avx2( ) );
+#endif
+#if defined( DAW_JSON_HAS_AVX512_KERNELS )
+	test_kernels<avx512_exec_tag>( "avx512", cpu_supports_avx512( ) );
+#endif
+#if defined( DAW_JSON_CPU_DISPATCH )
+	// Runs whichever kernels the CPU supports, down to the byte loops
+	test_kernels<cpu_dispatch_exec_tag>( "cpu_dispatch", true );
+#endif
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
@@ -194,6 +194,32 @@ int main( int, char ** )
 	do_test( test_escaped_quote_002<daw::json::options::ExecModeTypes::simd>( ) );
 	do_test( test_escaped_quote_003<daw::json::options::ExecModeTypes::simd>( ) );
 	do_test( test_escaped_quote_004<daw::json::options::ExecModeTypes::simd>( ) );
+#endif
+#if defined( DAW_ALLOW_AVX2 )
+	do_test( test_escaped_quote_001<daw::json::options::ExecModeTypes::avx2>( ) );
+	do_test( test_escaped_quote_002<daw::json::options::ExecModeTypes::avx2>( ) );
+	do_test( test_escaped_quote_003<daw::json::options::ExecModeTypes::avx2>( ) );
+	do_test( test_escaped_quote_004<daw::json::options::ExecModeTypes::avx2>( ) );
+#endif
+#if defined( DAW_ALLOW_AVX512 )
+	do_test(
+	  test_escaped_quote_001<daw::json::options::ExecModeTypes::avx512>( ) );
+	do_test(
+	  test_escaped_quote_002<daw::json::options::ExecModeTypes::avx512>( ) );
+	do_test(
+	  test_escaped_quote_003<daw::json::options::ExecModeTypes::avx512>( ) );
+	do_test(
+	  test_escaped_quote_004<daw::json::options::ExecModeTypes::avx512>( ) );
+#endif
+#if defined( DAW_JSON_CPU_DISPATCH )
+	do_test( test_escaped_quote_001<
+	         daw::json::options::ExecModeTypes::cpu_dispatch>( ) );
+	do_test( test_escaped_quote_002<
+	         daw::json::options::ExecModeTypes::cpu_dispatch>( ) );
+	do_test( test_escaped_quote_003<
+	         daw::json::options::ExecModeTypes::cpu_dispatch>( ) );
+	do_test( test_escaped_quote_004<
+	         daw::json::options::ExecModeTypes::cpu_dispatch>( ) );
 #endif
 	do_fail_test( test_missing_quotes_001( ) );
 	do_fail_test( test_missing_quotes_002( ) );
@@ -0,0 +1,155 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// The whitespace and bracketed item skips of the avx2, avx512, and
+// cpu_dispatch exec modes jump between structural characters with the wide
+// kernels.  Check that they stop at the same place as the byte at a time
+// compile_time mode, with every character of the document moved across each
+// 16, 32, and 64 byte block boundary.
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <daw/daw_ensure.h>
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+using namespace daw::json;
+
+namespace {
+	template<options::ExecModeTypes ExecMode,
+	         options::PolicyCommentTypes CommentPolicy,
+	         options::CheckedParseMode Checked>
+	using policy_t =
+	  BasicParsePolicy<parse_options( ExecMode, CommentPolicy, Checked )>;
+
+	/// A run of whitespace of every kind that is pad characters long
+	std::string whitespace( std::size_t pad ) {
+		constexpr std::string_view kinds = " \t\n\r  ";
+		auto result = std::string( );
+		for( std::size_t n = 0; n < pad; ++n ) {
+			result.push_back( kinds[n % kinds.size( )] );
+		}
+		return result;
+	}
+
+	std::string_view comment( options::PolicyCommentTypes comment_policy ) {
+		switch( comment_policy ) {
+		case options::PolicyCommentTypes::cpp:
+			return "// ] } \" [\n/* [ { */ ";
+		case options::PolicyCommentTypes::hash:
+			return "# ] } \" [\n";
+		case options::PolicyCommentTypes::none:
+			break;
+		}
+		return "";
+	}
+
+	template<options::ExecModeTypes ExecMode,
+	         options::PolicyCommentTypes CommentPolicy,
+	         options::CheckedParseMode Checked>
+	void test_trim_left( std::size_t pad ) {
+		using wide_t = policy_t<ExecMode, CommentPolicy, Checked>;
+		using scalar_t = policy_t<options::ExecModeTypes::compile_time,
+		                          CommentPolicy, Checked>;
+		auto const doc = whitespace( pad ) +
+		                 std::string( comment( CommentPolicy ) ) +
+		                 whitespace( pad ) + "x";
+		auto wide = wide_t( doc.data( ), doc.data( ) + doc.size( ) );
+		auto scalar = scalar_t( doc.data( ), doc.data( ) + doc.size( ) );
+		wide.trim_left( );
+		scalar.trim_left( );
+		daw_ensure( wide.first == scalar.first );
+	}
+
+	template<options::ExecModeTypes ExecMode,
+	         options::PolicyCommentTypes CommentPolicy,
+	         options::CheckedParseMode Checked>
+	void test_skip_bracketed( std::size_t pad ) {
+		using wide_t = policy_t<ExecMode, CommentPolicy, Checked>;
+		using scalar_t = policy_t<options::ExecModeTypes::compile_time,
+		                          CommentPolicy, Checked>;
+		auto const ws = whitespace( pad );
+		auto const doc = "[" + ws + R"({"a": [1, 2, "x\"]y"], "b\\": {}},)" + ws +
+		                 std::string( comment( CommentPolicy ) ) +
+		                 R"([[], "{[,]}"], 3,)" + ws + "4" + ws + "] , 5";
+		auto wide = wide_t( doc.data( ), doc.data( ) + doc.size( ) );
+		auto scalar = scalar_t( doc.data( ), doc.data( ) + doc.size( ) );
+		auto const wide_result = wide.skip_array( );
+		auto const scalar_result = scalar.skip_array( );
+		daw_ensure( wide.first == scalar.first );
+		daw_ensure( wide_result.last == scalar_result.last );
+		daw_ensure( wide_result.counter == scalar_result.counter );
+		daw_ensure( *( wide_result.last - 1 ) == ']' );
+
+		auto const cls = "{" + ws + R"("a": {"b": [1, {}]},)" + ws +
+		                 std::string( comment( CommentPolicy ) ) +
+		                 R"("c": "}")" + ws + "}";
+		auto wide_cls = wide_t( cls.data( ), cls.data( ) + cls.size( ) );
+		auto scalar_cls = scalar_t( cls.data( ), cls.data( ) + cls.size( ) );
+		auto const wide_cls_result = wide_cls.skip_class( );
+		auto const scalar_cls_result = scalar_cls.skip_class( );
+		daw_ensure( wide_cls.first == scalar_cls.first );
+		daw_ensure( wide_cls_result.last == scalar_cls_result.last );
+		daw_ensure( wide_cls_result.counter == scalar_cls_result.counter );
+		daw_ensure( wide_cls.first == cls.data( ) + cls.size( ) );
+	}
+
+	template<options::ExecModeTypes ExecMode,
+	         options::PolicyCommentTypes CommentPolicy>
+	void test_policy( ) {
+		// Twice the widest block and one more, so every character crosses each
+		// block boundary
+		for( std::size_t pad = 0; pad <= 129; ++pad ) {
+			test_trim_left<ExecMode, CommentPolicy,
+			               options::CheckedParseMode::yes>( pad );
+			test_trim_left<ExecMode, CommentPolicy, options::CheckedParseMode::no>(
+			  pad );
+			test_skip_bracketed<ExecMode, CommentPolicy,
+			                    options::CheckedParseMode::yes>( pad );
+			test_skip_bracketed<ExecMode, CommentPolicy,
+			                    options::CheckedParseMode::no>( pad );
+		}
+	}
+
+	template<options::ExecModeTypes ExecMode>
+	void test_exec_mode( std::string_view name ) {
+		test_policy<ExecMode, options::PolicyCommentTypes::none>( );
+		test_policy<ExecMode, options::PolicyCommentTypes::cpp>( );
+		test_policy<ExecMode, options::PolicyCommentTypes::hash>( );
+		std::cout << name << " skips match compile_time\n";
+	}
+} // namespace
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	// The scalar exec modes must match themselves, this keeps the test useful
+	// when no wide exec mode is enabled
+	test_exec_mode<options::ExecModeTypes::runtime>( "runtime" );
+#if defined( DAW_ALLOW_AVX2 )
+	test_exec_mode<options::ExecModeTypes::avx2>( "avx2" );
+#endif
+#if defined( DAW_ALLOW_AVX512 )
+	test_exec_mode<options::ExecModeTypes::avx512>( "avx512" );
+#endif
+#if defined( DAW_JSON_CPU_DISPATCH )
+	test_exec_mode<options::ExecModeTypes::cpu_dispatch>( "cpu_dispatch" );
+#endif
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
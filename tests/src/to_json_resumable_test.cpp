@@ -0,0 +1,107 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_to_json_resumable.h>
+
+#include <daw/daw_ensure.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <deque>
+#include <string>
+#include <vector>
+
+struct record {
+	std::int64_t id;
+	std::string name;
+	std::vector<double> values;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<record> {
+		static constexpr char const id[] = "id";
+		static constexpr char const name[] = "name";
+		static constexpr char const values[] = "values";
+		using type =
+		  json_member_list<json_number<id, std::int64_t>, json_string<name>,
+		                   json_array<values, double>>;
+
+		static constexpr auto to_json_data( record const &r ) {
+			return std::forward_as_tuple( r.id, r.name, r.values );
+		}
+	};
+} // namespace daw::json
+
+// Stream the document through a buffer of BufferSize bytes
+template<std::size_t BufferSize, typename Serialize>
+std::string stream_through( Serialize serialize ) {
+	auto buffer = std::array<char, BufferSize>{ };
+	auto position = daw::json::json_serialize_position{ };
+	std::string result{ };
+	while( true ) {
+		auto const r = serialize( buffer, position );
+		daw_ensure( r.size <= BufferSize );
+		result.append( buffer.data( ), r.size );
+		if( r.is_complete ) {
+			return result;
+		}
+		daw_ensure( r.size > 0 );
+		position = r.position;
+	}
+}
+
+template<std::size_t BufferSize, typename Container, typename... Flags>
+void test_array( Container const &c, Flags... flags ) {
+	auto const expected = daw::json::to_json_array( c, flags... );
+	auto const result =
+	  stream_through<BufferSize>( [&]( auto &buffer, auto position ) {
+		  return daw::json::to_json_array_resumable( c, buffer, position,
+		                                             flags... );
+	  } );
+	daw_ensure( result == expected );
+}
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	using namespace daw::json;
+	auto records = std::vector<record>( );
+	for( std::int64_t n = 0; n < 500; ++n ) {
+		auto r = record{ n, "record \"" + std::string( n % 50, 'x' ) + "\"", { } };
+		for( std::int64_t m = 0; m < n % 7; ++m ) {
+			r.values.push_back( static_cast<double>( n ) + 0.25 );
+		}
+		records.push_back( std::move( r ) );
+	}
+
+	// Buffers smaller than one element, about one element, and larger
+	test_array<1>( records );
+	test_array<7>( records );
+	test_array<64>( records );
+	test_array<4096>( records );
+	test_array<7>( records,
+	               options::output_flags<options::SerializationFormat::Pretty> );
+	test_array<7>( std::vector<record>( ) );
+	test_array<3>( std::vector<record>( ),
+	               options::output_flags<options::SerializationFormat::Pretty> );
+	test_array<5>( std::deque<int>{ 1, 22, 333, 4444 } );
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
@@ -0,0 +1,166 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  This test will benchmark parsing twitter.json into std::pmr types, with
+//  the memory from the heap and from a json_arena, and count the allocations
+//  of each
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_arena.h>
+
+#if defined( DAW_JSON_HAS_ARENA )
+#define DAW_JSON_TEST_PMR
+#include "twitter_test_alloc_json.h"
+#endif
+
+#include <daw/daw_benchmark.h>
+#include <daw/daw_read_file.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <optional>
+#include <string_view>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 250;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+static std::size_t heap_allocations = 0;
+
+void *operator new( std::size_t size ) {
+	++heap_allocations;
+	if( void *ptr = std::malloc( size == 0 ? 1 : size ); ptr ) {
+		return ptr;
+	}
+#if defined( DAW_USE_EXCEPTIONS )
+	throw std::bad_alloc( );
+#else
+	std::abort( );
+#endif
+}
+
+void operator delete( void *ptr ) noexcept {
+	std::free( ptr );
+}
+
+void operator delete( void *ptr, std::size_t ) noexcept {
+	std::free( ptr );
+}
+
+#if defined( DAW_JSON_HAS_ARENA )
+using namespace daw::json::options;
+
+template<typename Result>
+void check_result( Result const &twitter_result ) {
+	test_assert( twitter_result, "Missing value" );
+	test_assert( not twitter_result->statuses.empty( ), "Expected values" );
+	test_assert( twitter_result->statuses.front( ).user.id == 1186275104,
+	             "Missing value" );
+}
+
+template<ExecModeTypes ExecMode>
+void test( std::string_view json_data, daw::json::json_arena &arena ) {
+	std::cout << "Using " << to_string( ExecMode )
+	          << " exec model\n*********************************************\n";
+	auto const sz = json_data.size( );
+	std::optional<daw::twitter::twitter_object_t> twitter_result;
+	{
+		heap_allocations = 0;
+		(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+		  "twitter bench(heap)", sz,
+		  [&]( auto f1 ) {
+			  twitter_result.reset( );
+			  twitter_result =
+			    daw::json::from_json<daw::twitter::twitter_object_t>(
+			      f1, parse_flags<ExecMode> );
+			  daw::do_not_optimize( twitter_result );
+		  },
+		  json_data );
+		std::cout << "Heap allocations per parse: "
+		          << heap_allocations / DAW_NUM_RUNS << '\n';
+		check_result( twitter_result );
+	}
+	{
+		twitter_result.reset( );
+		heap_allocations = 0;
+		(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+		  "twitter bench(arena)", sz,
+		  [&]( auto f1 ) {
+			  twitter_result.reset( );
+			  arena.release( );
+			  twitter_result =
+			    daw::json::from_json_arena<daw::twitter::twitter_object_t>(
+			      f1, arena, parse_flags<ExecMode> );
+			  daw::do_not_optimize( twitter_result );
+		  },
+		  json_data );
+		std::cout << "Heap allocations per parse: "
+		          << heap_allocations / DAW_NUM_RUNS << '\n';
+		std::cout << "Arena allocations per parse: " << arena.allocation_count( )
+		          << ", " << arena.bytes_allocated( ) << " bytes\n";
+		check_result( twitter_result );
+	}
+	twitter_result.reset( );
+	arena.release( );
+}
+#endif
+
+int main( int argc, char **argv )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+#if defined( DAW_JSON_HAS_ARENA )
+	using namespace daw::json;
+	if( argc < 2 ) {
+		std::cerr << "Must supply a filenames to open\n";
+		exit( 1 );
+	}
+
+	auto const json_data1 = *daw::read_file( argv[1] );
+	auto const json_data =
+	  std::string_view( json_data1.data( ), json_data1.size( ) );
+
+	auto const sz = json_data.size( );
+	std::cout << "Processing: " << daw::utility::to_bytes_per_second( sz )
+	          << '\n';
+	auto arena = json_arena( );
+	test<ExecModeTypes::compile_time>( json_data, arena );
+	test<ExecModeTypes::runtime>( json_data, arena );
+	if constexpr( not std::is_same_v<daw::json::simd_exec_tag,
+	                                 daw::json::runtime_exec_tag> ) {
+		test<ExecModeTypes::simd>( json_data, arena );
+	}
+#else
+	(void)argc;
+	(void)argv;
+	std::cout << "std::pmr is not available, json_arena is not supported\n";
+#endif
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
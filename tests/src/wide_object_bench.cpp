@@ -0,0 +1,164 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+/// @brief Parses arrays of classes with many members, with the members in
+/// order, reversed, and shuffled with unknown members between them.  Built
+/// twice, once with DAW_JSON_NO_MEMBER_PERFECT_HASH to compare the perfect
+/// hash member lookup with the linear search
+
+#include "daw_json_benchmark.h"
+#include "defines.h"
+
+#include <daw/daw_ensure.h>
+#include <daw/json/daw_json_link.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 50;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+#if defined( DAW_JSON_NO_MEMBER_PERFECT_HASH )
+static constexpr char const lookup_name[] = "linear member lookup";
+#else
+static constexpr char const lookup_name[] = "perfect hash member lookup";
+#endif
+
+inline constexpr std::size_t wide_member_count = 96;
+inline constexpr std::size_t wide_object_count = 2'000;
+
+template<std::size_t I>
+inline constexpr char const wide_member_name[] = {
+  'f', 'i', 'e', 'l', 'd', '_', static_cast<char>( '0' + I / 100 ),
+  static_cast<char>( '0' + ( I / 10 ) % 10 ), static_cast<char>( '0' + I % 10 ),
+  '\0' };
+
+struct wide_object {
+	std::array<std::int64_t, wide_member_count> values{ };
+
+	wide_object( ) = default;
+
+	template<typename... Ints,
+	         std::enable_if_t<( sizeof...( Ints ) == wide_member_count ),
+	                          std::nullptr_t> = nullptr>
+	explicit wide_object( Ints... vs )
+	  : values{ static_cast<std::int64_t>( vs )... } {}
+};
+
+template<std::size_t... Is>
+auto wide_member_list( std::index_sequence<Is...> )
+  -> daw::json::json_member_list<
+    daw::json::json_number<wide_member_name<Is>, std::int64_t>...>;
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<wide_object> {
+		using type = decltype( wide_member_list(
+		  std::make_index_sequence<wide_member_count>{ } ) );
+	};
+} // namespace daw::json
+
+enum class member_order { in_order, reversed, shuffled_with_unknowns };
+
+std::string make_wide_object_doc( member_order order ) {
+	auto rng = std::mt19937( 42 );
+	auto positions = std::vector<std::size_t>( wide_member_count );
+	std::iota( positions.begin( ), positions.end( ), std::size_t{ 0 } );
+	if( order == member_order::reversed ) {
+		std::reverse( positions.begin( ), positions.end( ) );
+	}
+	std::string result = "[";
+	for( std::size_t n = 0; n < wide_object_count; ++n ) {
+		if( n > 0 ) {
+			result += ',';
+		}
+		if( order == member_order::shuffled_with_unknowns ) {
+			std::shuffle( positions.begin( ), positions.end( ), rng );
+		}
+		result += '{';
+		for( std::size_t m = 0; m < wide_member_count; ++m ) {
+			if( m > 0 ) {
+				result += ',';
+			}
+			if( order == member_order::shuffled_with_unknowns and m % 3 == 0 ) {
+				result += "\"unknown_" + std::to_string( m ) + "\":[1,2,3],";
+			}
+			auto const pos = positions[m];
+			auto name = std::string( "field_000" );
+			name[6] = static_cast<char>( '0' + pos / 100 );
+			name[7] = static_cast<char>( '0' + ( pos / 10 ) % 10 );
+			name[8] = static_cast<char>( '0' + pos % 10 );
+			result += '"' + name + "\":" + std::to_string( n + pos );
+		}
+		result += '}';
+	}
+	result += ']';
+	return result;
+}
+
+std::int64_t expected_sum( ) {
+	std::int64_t result = 0;
+	for( std::size_t n = 0; n < wide_object_count; ++n ) {
+		for( std::size_t pos = 0; pos < wide_member_count; ++pos ) {
+			result += static_cast<std::int64_t>( n + pos );
+		}
+	}
+	return result;
+}
+
+void bench( std::string const &title, std::string const &json_doc ) {
+	auto const result = daw::json::benchmark::benchmark(
+	  DAW_NUM_RUNS, json_doc.size( ), title + " - " + lookup_name,
+	  []( std::string const &jd ) {
+		  auto const objs = daw::json::from_json_array<wide_object>(
+		    jd, daw::json::options::parse_flags<
+		          daw::json::options::CheckedParseMode::no> );
+		  std::int64_t sum = 0;
+		  for( auto const &obj : objs ) {
+			  for( auto v : obj.values ) {
+				  sum += v;
+			  }
+		  }
+		  return sum;
+	  },
+	  json_doc );
+	daw_ensure( result.has_value( ) );
+	daw_ensure( result.get( ) == expected_sum( ) );
+}
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	std::cout << "Classes with " << wide_member_count << " members\n";
+	bench( "in order", make_wide_object_doc( member_order::in_order ) );
+	bench( "reversed", make_wide_object_doc( member_order::reversed ) );
+	bench( "shuffled with unknowns",
+	       make_wide_object_doc( member_order::shuffled_with_unknowns ) );
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif